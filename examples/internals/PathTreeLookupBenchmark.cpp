@@ -0,0 +1,111 @@
+/** @file
+    @brief Implementation of a microbenchmark for building a large path tree
+    and looking up nodes in it by path.
+
+    Run with no arguments, or with the number of children per level (default
+    50, giving a tree of over 10000 nodes).
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/PathTreeFull.h>
+#include <osvr/Common/PathElementTypes.h>
+#include <osvr/Common/PathTreeSerialization.h>
+
+// Library/third-party includes
+#include <json/value.h>
+
+// Standard includes
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using osvr::common::PathTree;
+using namespace osvr::common::elements;
+typedef std::chrono::steady_clock clock_type;
+
+/// @brief Milliseconds elapsed since @p start
+static double msSince(clock_type::time_point start) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() -
+                                                     start)
+        .count();
+}
+
+static const int REPEATS = 10;
+static const int SENSORS = 4;
+
+int main(int argc, char *argv[]) {
+    std::size_t fanout = 50;
+    if (argc > 1) {
+        fanout = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    // Paths shaped like a server's: plugins, each with devices, each with a
+    // tracker interface and several sensors.
+    std::vector<std::string> leaves;
+    leaves.reserve(fanout * fanout * SENSORS);
+    for (std::size_t p = 0; p < fanout; ++p) {
+        for (std::size_t d = 0; d < fanout; ++d) {
+            for (int s = 0; s < SENSORS; ++s) {
+                leaves.push_back("/com_osvr_Plugin" + std::to_string(p) +
+                                 "/Device" + std::to_string(d) + "/tracker/" +
+                                 std::to_string(s));
+            }
+        }
+    }
+
+    PathTree tree;
+    auto start = clock_type::now();
+    for (auto const &path : leaves) {
+        tree.getNodeByPath(path, SensorElement());
+    }
+    std::cout << "Building tree with " << leaves.size()
+              << " leaf paths: " << msSince(start) << " ms" << std::endl;
+
+    PathTree const &constTree = tree;
+    std::size_t found = 0;
+    start = clock_type::now();
+    for (int i = 0; i < REPEATS; ++i) {
+        for (auto const &path : leaves) {
+            found += constTree.getNodeByPath(path).hasChildren() ? 0 : 1;
+        }
+    }
+    std::cout << "Looking up all leaf paths: " << msSince(start) / REPEATS
+              << " ms per pass" << std::endl;
+    if (found != leaves.size() * REPEATS) {
+        std::cerr << "Unexpected tree structure!" << std::endl;
+        return 1;
+    }
+
+    auto nodes = osvr::common::pathTreeToJson(tree);
+    start = clock_type::now();
+    for (int i = 0; i < REPEATS; ++i) {
+        PathTree copy;
+        osvr::common::jsonToPathTree(copy, nodes);
+    }
+    std::cout << "Rebuilding from " << nodes.size()
+              << " serialized nodes: " << msSince(start) / REPEATS
+              << " ms per pass" << std::endl;
+    return 0;
+}
@@ -0,0 +1,165 @@
+/** @file
+    @brief Implementation of a microbenchmark comparing full path tree
+    replacement against versioned deltas for small configuration changes.
+
+    Run with no arguments, or with the number of devices to put in the tree
+    (default 200, giving well over 1000 nodes).
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/PathTreeFull.h>
+#include <osvr/Common/PathElementTypes.h>
+#include <osvr/Common/PathTreeSerialization.h>
+
+// Library/third-party includes
+#include <json/value.h>
+#include <json/writer.h>
+#include <boost/variant/get.hpp>
+
+// Standard includes
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using osvr::common::PathTree;
+using namespace osvr::common::elements;
+typedef std::chrono::steady_clock clock_type;
+
+/// @brief Milliseconds elapsed since @p start
+static double msSince(clock_type::time_point start) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() -
+                                                     start)
+        .count();
+}
+
+static const int UPDATES = 100;
+static const int SENSORS = 4;
+
+static std::string getDevicePath(std::size_t i) {
+    return "/com_osvr_Plugin" + std::to_string(i % 10) + "/Device" +
+           std::to_string(i);
+}
+
+/// @brief Populate a tree shaped like a busy server's: devices with a tracker
+/// interface and several sensors each, plus an alias per sensor.
+static void populate(PathTree &tree, std::size_t devices) {
+    for (std::size_t i = 0; i < devices; ++i) {
+        auto devPath = getDevicePath(i);
+        tree.getNodeByPath("/com_osvr_Plugin" + std::to_string(i % 10),
+                           PluginElement());
+        tree.getNodeByPath(devPath,
+                           DeviceElement::createVRPNDeviceElement(
+                               devPath.substr(1), "localhost"));
+        tree.getNodeByPath(devPath + "/tracker", InterfaceElement());
+        for (int s = 0; s < SENSORS; ++s) {
+            tree.getNodeByPath(devPath + "/tracker/" + std::to_string(s),
+                               SensorElement());
+            tree.getNodeByPath("/user" + std::to_string(i) + "/sensor" +
+                                   std::to_string(s),
+                               AliasElement(devPath + "/tracker/" +
+                                            std::to_string(s)));
+        }
+    }
+}
+
+/// @brief Make a small change: re-point a single alias to the next sensor.
+static void mutate(PathTree &tree, std::size_t devices, int iteration) {
+    auto i = static_cast<std::size_t>(iteration) % devices;
+    auto &alias = boost::get<AliasElement>(
+        tree.getNodeByPath("/user" + std::to_string(i) + "/sensor0").value());
+    auto sensor = (alias.getSource().back() - '0' + 1) % SENSORS;
+    alias.setSource(getDevicePath(i) + "/tracker/" + std::to_string(sensor));
+}
+
+int main(int argc, char *argv[]) {
+    std::size_t devices = 200;
+    if (argc > 1) {
+        devices = std::strtoul(argv[1], nullptr, 10);
+    }
+    if (devices == 0) {
+        std::cerr << "Need at least one device." << std::endl;
+        return 1;
+    }
+
+    PathTree server;
+    populate(server, devices);
+    auto nodes = osvr::common::pathTreeToJson(server);
+    std::cout << "Path tree with " << nodes.size() << " nodes, " << UPDATES
+              << " single-alias updates each" << std::endl;
+
+    Json::FastWriter writer;
+    {
+        // What the server and client do for a full replacement tree.
+        PathTree client;
+        std::size_t bytes = 0;
+        double serverMs = 0;
+        double clientMs = 0;
+        for (int i = 0; i < UPDATES; ++i) {
+            mutate(server, devices, i);
+            auto start = clock_type::now();
+            auto msg = osvr::common::pathTreeToJson(server);
+            serverMs += msSince(start);
+            bytes += writer.write(msg).size();
+            start = clock_type::now();
+            client.reset();
+            osvr::common::jsonToPathTree(client, msg);
+            clientMs += msSince(start);
+        }
+        std::cout << "Full replacement: server " << serverMs / UPDATES
+                  << " ms, client " << clientMs / UPDATES << " ms, "
+                  << bytes / UPDATES << " bytes per update" << std::endl;
+    }
+    {
+        // What the server and client do for a delta.
+        PathTree client;
+        auto lastSent = osvr::common::pathTreeToJson(server);
+        osvr::common::jsonToPathTree(client, lastSent);
+        std::size_t bytes = 0;
+        double serverMs = 0;
+        double clientMs = 0;
+        for (int i = 0; i < UPDATES; ++i) {
+            mutate(server, devices, i);
+            auto start = clock_type::now();
+            auto current = osvr::common::pathTreeToJson(server);
+            auto delta = osvr::common::diffPathTreeJson(lastSent, current);
+            serverMs += msSince(start);
+            bytes += writer.write(delta).size();
+            start = clock_type::now();
+            osvr::common::applyPathTreeDelta(client, delta);
+            clientMs += msSince(start);
+            lastSent = std::move(current);
+        }
+        std::cout << "Delta: server " << serverMs / UPDATES << " ms, client "
+                  << clientMs / UPDATES << " ms, " << bytes / UPDATES
+                  << " bytes per update" << std::endl;
+
+        auto check = osvr::common::diffPathTreeJson(
+            osvr::common::pathTreeToJson(client), lastSent);
+        if (!osvr::common::isPathTreeDeltaEmpty(check)) {
+            std::cerr << "Client tree diverged from server tree!" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
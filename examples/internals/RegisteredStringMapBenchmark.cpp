@@ -0,0 +1,94 @@
+/** @file
+    @brief Implementation of a microbenchmark for string registration and
+    peer-mapping setup in RegisteredStringMap/CorrelatedStringMap.
+
+    Run with no arguments, or with the number of strings to register
+    (default 10000).
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/RegisteredStringMap.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using osvr::common::RegisteredStringMap;
+using osvr::common::CorrelatedStringMap;
+typedef std::chrono::steady_clock clock_type;
+
+/// @brief Milliseconds elapsed since @p start
+static double msSince(clock_type::time_point start) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() -
+                                                     start)
+        .count();
+}
+
+int main(int argc, char *argv[]) {
+    std::size_t count = 10000;
+    if (argc > 1) {
+        count = std::strtoul(argv[1], nullptr, 10);
+    }
+
+    // Names shaped like message types and senders on a busy server.
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        names.push_back("com_osvr_Device" + std::to_string(i % 100) +
+                        "/Message_" + std::to_string(i));
+    }
+
+    RegisteredStringMap server;
+    auto start = clock_type::now();
+    for (auto const &name : names) {
+        server.getStringID(name);
+    }
+    std::cout << "Registering " << count << " strings: " << msSince(start)
+              << " ms" << std::endl;
+
+    start = clock_type::now();
+    for (auto const &name : names) {
+        server.getStringID(name);
+    }
+    std::cout << "Looking up " << count << " registered strings: "
+              << msSince(start) << " ms" << std::endl;
+
+    // A client that already knows half of the names, in a different order,
+    // then reconciles with the server's full list.
+    CorrelatedStringMap client;
+    for (std::size_t i = count / 2; i > 0; --i) {
+        client.getStringID(names[i * 2 - 1]);
+    }
+    auto entries = server.getEntries();
+    start = clock_type::now();
+    client.setupPeerMappings(entries);
+    std::cout << "Peer-mapping setup for " << count << " strings: "
+              << msSince(start) << " ms" << std::endl;
+    return 0;
+}
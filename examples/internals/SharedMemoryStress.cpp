@@ -0,0 +1,221 @@
+/** @file
+    @brief Implementation of a multi-process stress benchmark for the shared
+    memory ring buffer: one writer publishing frames as fast as it can, and a
+    number of reader processes polling for the latest frame.
+
+    Run with no arguments (or a duration in seconds, an entry size in bytes,
+    and a frame rate limit - 0 for none) to benchmark with 1, 4, and 16 reader
+    processes in turn: it launches copies of itself in reader mode.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/IPCRingBuffer.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using osvr::common::IPCRingBuffer;
+typedef std::chrono::steady_clock clock_type;
+
+/// @brief Written at the start of every entry. The steady clock is
+/// system-wide on the platforms we care about, so the stamp can be compared
+/// across processes.
+struct FrameHeader {
+    std::int64_t stampNanoseconds;
+    std::uint32_t done;
+};
+
+static std::int64_t nowNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               clock_type::now().time_since_epoch())
+        .count();
+}
+
+static std::int64_t percentile(std::vector<std::int64_t> const &sorted,
+                               double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    auto idx = std::min(sorted.size() - 1,
+                        static_cast<std::size_t>(sorted.size() * p));
+    return sorted[idx];
+}
+
+static int runReader(std::string const &name, int timeoutSeconds) {
+    auto buf = IPCRingBuffer::find(IPCRingBuffer::Options(name));
+    if (!buf) {
+        std::cerr << "Reader couldn't find ring buffer " << name << std::endl;
+        return 1;
+    }
+    std::vector<std::int64_t> latencies;
+    latencies.reserve(1 << 20);
+    std::size_t skipped = 0;
+    std::size_t failed = 0;
+    bool haveLast = false;
+    IPCRingBuffer::sequence_type last = 0;
+    auto start = clock_type::now();
+    auto deadline = start + std::chrono::seconds(timeoutSeconds);
+    while (clock_type::now() < deadline) {
+        auto res = buf->getLatest();
+        if (!res) {
+            // Before the first frame, there's just nothing to read yet.
+            if (haveLast) {
+                ++failed;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+        auto seq = res.getSequenceNumber();
+        if (haveLast && seq == last) {
+            std::this_thread::yield();
+            continue;
+        }
+        FrameHeader header;
+        std::memcpy(&header, res.get(), sizeof(header));
+        if (header.done) {
+            break;
+        }
+        latencies.push_back(nowNanoseconds() - header.stampNanoseconds);
+        if (haveLast) {
+            skipped += seq - last - 1;
+        } else {
+            start = clock_type::now();
+        }
+        last = seq;
+        haveLast = true;
+    }
+    auto elapsed =
+        std::chrono::duration<double>(clock_type::now() - start).count();
+    std::sort(latencies.begin(), latencies.end());
+
+    std::ostringstream os;
+    os << "  reader: " << latencies.size() << " frames ("
+       << latencies.size() / elapsed << "/s), " << skipped << " skipped, "
+       << failed << " failed reads; latency (us) p50 "
+       << percentile(latencies, 0.5) / 1000 << " p99 "
+       << percentile(latencies, 0.99) / 1000 << " p99.9 "
+       << percentile(latencies, 0.999) / 1000 << " max "
+       << percentile(latencies, 1.0) / 1000 << "\n";
+    std::cout << os.str() << std::flush;
+    return 0;
+}
+
+static void runWriter(std::string const &self, int numReaders,
+                      int durationSeconds, std::uint32_t entrySize,
+                      int framesPerSecond) {
+    std::ostringstream nameStream;
+    nameStream << "OSVRSharedMemoryStress" << numReaders;
+    auto name = nameStream.str();
+    auto buf = IPCRingBuffer::create(
+        IPCRingBuffer::Options(name).setEntrySize(entrySize));
+    if (!buf) {
+        std::cerr << "Couldn't create ring buffer " << name << std::endl;
+        return;
+    }
+
+    std::ostringstream cmd;
+    cmd << "\"" << self << "\" --reader " << name << " "
+        << durationSeconds + 10;
+    std::vector<std::thread> readers;
+    for (int i = 0; i < numReaders; ++i) {
+        auto command = cmd.str();
+        readers.emplace_back([command] { std::system(command.c_str()); });
+    }
+    // Give the readers a moment to start up and find the ring buffer.
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    std::size_t frames = 0;
+    auto start = clock_type::now();
+    auto end = start + std::chrono::seconds(durationSeconds);
+    FrameHeader header = {0, 0};
+    auto nextFrame = start;
+    while (clock_type::now() < end) {
+        if (framesPerSecond > 0) {
+            nextFrame += std::chrono::microseconds(1000000 / framesPerSecond);
+            std::this_thread::sleep_until(nextFrame);
+        }
+        auto proxy = buf->put();
+        // Simulate producing a full frame.
+        std::memset(proxy.get() + sizeof(header), int(frames & 0xff),
+                    entrySize - sizeof(header));
+        header.stampNanoseconds = nowNanoseconds();
+        std::memcpy(proxy.get(), &header, sizeof(header));
+        ++frames;
+    }
+    auto elapsed =
+        std::chrono::duration<double>(clock_type::now() - start).count();
+    {
+        auto proxy = buf->put();
+        header.stampNanoseconds = nowNanoseconds();
+        header.done = 1;
+        std::memcpy(proxy.get(), &header, sizeof(header));
+    }
+    std::cout << numReaders << " reader process(es): writer published "
+              << frames << " frames of " << entrySize << " bytes ("
+              << frames / elapsed << " frames/s)" << std::endl;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc == 4 && std::string(argv[1]) == "--reader") {
+        return runReader(argv[2], std::atoi(argv[3]));
+    }
+    int durationSeconds = 5;
+    std::uint32_t entrySize = 640 * 480 * 3;
+    int framesPerSecond = 0;
+    if (argc > 1) {
+        durationSeconds = std::atoi(argv[1]);
+    }
+    if (argc > 2) {
+        entrySize = static_cast<std::uint32_t>(std::atol(argv[2]));
+    }
+    if (argc > 3) {
+        framesPerSecond = std::atoi(argv[3]);
+    }
+    if (durationSeconds <= 0 || entrySize < sizeof(FrameHeader) ||
+        framesPerSecond < 0) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [duration in seconds] [entry size in bytes] [max "
+                     "frames per second, 0 for unlimited]"
+                  << std::endl;
+        return 1;
+    }
+    for (int numReaders : {1, 4, 16}) {
+        runWriter(argv[0], numReaders, durationSeconds, entrySize,
+                  framesPerSecond);
+    }
+    return 0;
+}
@@ -32,12 +32,15 @@
 #include <osvr/Common/PathTree_fwd.h>
 #include <osvr/Common/ClientContext_fwd.h>
 #include <osvr/Client/InterfaceTree.h>
+#include <osvr/Common/ResolvedSourceCache.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
 #include <string>
+#include <unordered_map>
+#include <cstdint>
 
 namespace osvr {
 namespace common {
@@ -87,10 +90,18 @@ namespace client {
         /// or more interface objects but no remote handler.
         void m_connectNeededCallbacks();
 
+        /// @brief Called after the path tree changes: drops handlers for
+        /// those paths whose resolved source changed, then connects all paths
+        /// without handlers.
+        void m_refreshChangedHandlers();
+
         /// @brief Tree parallel to path tree for holding interface objects and
         /// remote handlers.
         InterfaceTree m_interfaces;
 
+        /// @brief Reference to the path tree owner passed into constructor.
+        common::PathTreeOwner &m_treeOwner;
+
         /// @brief Reference to the main path tree object, retrieved from the
         /// common::PathTreeOwner passed into constructor.
         common::PathTree &m_pathTree;
@@ -104,6 +115,16 @@ namespace client {
 
         /// @brief The client context that owns us.
         common::ClientContext *m_ctx;
+
+        /// @brief Cached resolution of paths to their original sources.
+        common::ResolvedSourceCache m_sources;
+
+        /// @brief Tree generation that m_sources is valid for.
+        std::uint64_t m_sourcesGeneration;
+
+        /// @brief For each path with a handler, a summary of the source it
+        /// was constructed from.
+        std::unordered_map<std::string, std::string> m_handlerSources;
     };
 } // namespace client
 } // namespace osvr
@@ -28,6 +28,7 @@
 // Internal Includes
 #include <osvr/Client/Export.h>
 #include <osvr/Common/ClientContext_fwd.h>
+#include <osvr/Common/InProcessReportsPtr.h>
 
 // Library/third-party includes
 // - none
@@ -43,9 +44,13 @@ namespace client {
     OSVR_CLIENT_EXPORT common::ClientContext *
     createContext(const char appId[], const char host[] = "localhost");
 
-    OSVR_CLIENT_EXPORT common::ClientContext *
-    createAnalysisClientContext(const char appId[], const char host[],
-                                vrpn_ConnectionPtr const& conn);
+    /// @param inProcessReports If not null, the server's hub through which
+    /// its devices can deliver reports to this context directly, instead of
+    /// over @p conn.
+    OSVR_CLIENT_EXPORT common::ClientContext *createAnalysisClientContext(
+        const char appId[], const char host[], vrpn_ConnectionPtr const &conn,
+        common::InProcessReportsPtr const &inProcessReports =
+            common::InProcessReportsPtr());
 } // namespace client
 } // namespace osvr
 
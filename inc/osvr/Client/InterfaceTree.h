@@ -103,6 +103,16 @@ namespace client {
             });
         }
 
+        /// @brief Visit all paths with a handler.
+        template <typename F> void visitPathsWithHandlers(F &&func) {
+            osvr::util::traverseWith(*m_root, [&](node_type &node) {
+                if (node.value().handler) {
+                    func(util::getTreeNodeFullPath(node,
+                                                   common::getPathSeparator()));
+                }
+            });
+        }
+
       private:
         /// @brief Returns a reference to a node for a given path.
         node_type &m_getNodeForPath(std::string const &path);
@@ -32,6 +32,7 @@
 #include <osvr/Common/OriginalSource.h>
 #include <osvr/Common/InterfaceList.h>
 #include <osvr/Common/ClientContext_fwd.h>
+#include <osvr/Common/InProcessReportsPtr.h>
 #include <osvr/Client/RemoteHandler.h>
 
 // Library/third-party includes
@@ -84,6 +85,15 @@ namespace client {
     populateRemoteHandlerFactory(RemoteHandlerFactory &factory,
                                  VRPNConnectionCollection const &conns);
 
+    /// @overload
+    ///
+    /// For contexts in the server process: handlers for devices in the same
+    /// process receive their reports directly through @p inProcessReports
+    /// where the device supports it.
+    OSVR_CLIENT_EXPORT void populateRemoteHandlerFactory(
+        RemoteHandlerFactory &factory, VRPNConnectionCollection const &conns,
+        common::InProcessReportsPtr const &inProcessReports);
+
 } // namespace client
 } // namespace osvr
 #endif // INCLUDED_RemoteHandlerFactory_h_GUID_3B3394C0_DADA_4BAA_3EDD_6CDA96760D91
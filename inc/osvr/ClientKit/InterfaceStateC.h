@@ -34,6 +34,7 @@
 #include <osvr/Util/APIBaseC.h>
 #include <osvr/Util/ReturnCodesC.h>
 #include <osvr/Util/AnnotationMacrosC.h>
+#include <osvr/Util/BoolC.h>
 #include <osvr/Util/ClientOpaqueTypesC.h>
 #include <osvr/Util/ClientReportTypesC.h>
 #include <osvr/Util/TimeValueC.h>
@@ -48,7 +49,8 @@ OSVR_EXTERN_C_BEGIN
 
 #define OSVR_CALLBACK_METHODS(TYPE)                                            \
     /** @brief Get TYPE state from an interface, returning failure if none     \
-     * exists */                                                               \
+     * exists. May be called from any thread, concurrently with                \
+     * osvrClientUpdate(), without blocking it. */                             \
     OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode osvrGet##TYPE##State(                \
         OSVR_ClientInterface iface, struct OSVR_TimeValue *timestamp,          \
         OSVR_##TYPE##State *state);
@@ -74,6 +76,27 @@ OSVR_CALLBACK_METHODS(NaviPosition)
 
 #undef OSVR_CALLBACK_METHODS
 
+/** @brief Get the pose state from an interface, predicted for a given time
+    using the last velocity report from the same interface, returning failure
+    if no pose exists. May be called from any thread, like the methods above.
+
+    The pose is extrapolated with constant linear and angular velocity (as
+    far as each is reported valid) from its timestamp to @p atTime, which may
+    be earlier or later, but by no more than @p maxPrediction seconds: a
+    longer interval is clamped to that bound. The pose and velocity are read
+    together, so they always come from the same update of the interface.
+
+    @param predictionValid Set to true only if velocity was available, was
+    reported no more than @p maxPrediction from the pose, and the interval
+    did not have to be clamped. When false, @p state is still the best
+    estimate available (at worst, the last reported pose).
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrGetPoseStateAtTime(OSVR_ClientInterface iface,
+                       struct OSVR_TimeValue const *atTime,
+                       double maxPrediction, OSVR_PoseState *state,
+                       OSVR_CBool *predictionValid);
+
 OSVR_EXTERN_C_END
 
 #endif
@@ -44,6 +44,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <cstdint>
 
 struct OSVR_ClientContextObject : boost::noncopyable {
   public:
@@ -107,6 +108,12 @@ struct OSVR_ClientContextObject : boost::noncopyable {
     OSVR_COMMON_EXPORT void
     setRoomToWorldTransform(osvr::common::Transform const &xform);
 
+    /// @brief Gets a counter that changes every time the room to world
+    /// transform is set, so that values derived from it can be cached.
+    std::uint64_t getRoomToWorldTransformVersion() const {
+        return m_roomToWorldVersion;
+    }
+
     /// @brief Returns the specialized deleter for this object.
     OSVR_COMMON_EXPORT osvr::common::ClientContextDeleter getDeleter() const;
 
@@ -159,6 +166,7 @@ struct OSVR_ClientContextObject : boost::noncopyable {
 
     osvr::util::MultipleKeyedOwnershipContainer m_ownedObjects;
     osvr::common::ClientContextDeleter m_deleter;
+    std::uint64_t m_roomToWorldVersion = 0;
 };
 
 namespace osvr {
@@ -67,16 +67,22 @@ struct OSVR_ClientInterfaceObject : boost::noncopyable {
     /// @{
     /// @brief If state exists for the given ReportType on this interface, it
     /// will be returned in the arguments, and true will be returned.
+    ///
+    /// Safe to call from any thread, even while another thread is updating
+    /// the client context: the newest complete state is returned without
+    /// locking.
     template <typename ReportType>
     bool
     getState(osvr::util::time::TimeValue &timestamp,
              osvr::common::traits::StateFromReport_t<ReportType> &state) const {
         osvr::common::tracing::markGetState(m_path);
-        if (!m_state.hasState<ReportType>()) {
-            return false;
-        }
-        m_state.getState<ReportType>(timestamp, state);
-        return true;
+        return m_state.getState<ReportType>(timestamp, state);
+    }
+
+    /// @brief Get the latest pose and velocity as one consistent pair.
+    bool getMotionState(osvr::common::MotionState &motion) const {
+        osvr::common::tracing::markGetState(m_path);
+        return m_state.getMotionState(motion);
     }
 
     template <typename ReportType> bool hasStateForReportType() const {
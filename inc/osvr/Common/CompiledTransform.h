@@ -0,0 +1,163 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_CompiledTransform_h_GUID_FE3A6E98_3B92_4D1C_B5DC_7876DB7C999E
+#define INCLUDED_CompiledTransform_h_GUID_FE3A6E98_3B92_4D1C_B5DC_7876DB7C999E
+
+// Internal Includes
+#include <osvr/Common/Transform.h>
+#include <osvr/Util/Pose3C.h>
+#include <osvr/Util/EigenInterop.h>
+
+// Library/third-party includes
+#include <osvr/Util/EigenCoreGeometry.h>
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+
+    /// @brief A Transform prepared for repeated application to poses and
+    /// vectors.
+    ///
+    /// When the pre and post matrices are both rigid (rotation and
+    /// translation only, as produced by the usual alias and room-to-world
+    /// transforms), they are stored as quaternion and translation pairs and
+    /// applied without building any 4x4 matrices. Otherwise, the matrix math
+    /// of Transform is used unchanged.
+    class CompiledTransform {
+      public:
+        /// @brief Identity transform.
+        CompiledTransform() { m_compile(Transform()); }
+
+        explicit CompiledTransform(Transform const &xform) {
+            m_compile(xform);
+        }
+
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+        /// @brief Does applying this transform leave everything unchanged?
+        bool isIdentity() const { return m_identity; }
+
+        /// @brief Is this transform applied using the quaternion and
+        /// translation fast path?
+        bool isRigid() const { return m_rigid; }
+
+        /// @brief Apply the transformation to a pose, in place: equivalent to
+        /// Transform::transform() on the pose's matrix.
+        void applyToPose(OSVR_Pose3 &pose) const {
+            namespace ei = util::eigen_interop;
+            if (m_identity) {
+                return;
+            }
+            if (!m_rigid) {
+                ei::map(pose) = m_general.transform(ei::map(pose).matrix());
+                return;
+            }
+            auto rotation = ei::map(pose).rotation().quat();
+            Eigen::Vector3d translation =
+                m_postRot * (rotation * m_preTrans +
+                             ei::map(pose).translation()) +
+                m_postTrans;
+            ei::map(pose).rotation() =
+                (m_postRot * rotation * m_preRot).normalized();
+            ei::map(pose).translation() = translation;
+        }
+
+        /// @brief Apply only the rotation/basis change (not the translation)
+        /// to a vector representing a velocity or acceleration: equivalent
+        /// to Transform::transformLinear().
+        Eigen::Vector3d
+        applyLinear(Eigen::Ref<Eigen::Vector3d const> const &vec) const {
+            return m_linear * vec;
+        }
+
+        /// @brief Apply the transformation to an incremental rotation (as in
+        /// an angular velocity or acceleration state) expressed in the same
+        /// frame as the poses passed to applyToPose().
+        ///
+        /// Orientations are transformed as post * R * pre, so a rotation
+        /// applied on the left ends up conjugated by the post rotation only:
+        /// the pre rotation doesn't change it.
+        Eigen::Quaterniond applyLinear(Eigen::Quaterniond const &quat) const {
+            if (m_identity) {
+                return quat;
+            }
+            if (m_rigid) {
+                return (m_postRot * quat * m_postRot.conjugate()).normalized();
+            }
+            Eigen::Matrix3d post = m_general.getPost().topLeftCorner<3, 3>();
+            return Eigen::Quaterniond(Eigen::Matrix3d(
+                                          post * quat.toRotationMatrix() *
+                                          post.inverse()))
+                .normalized();
+        }
+
+      private:
+        static bool m_isRigid(Eigen::Matrix4d const &mat) {
+            static const double TOLERANCE = 1e-9;
+            Eigen::Matrix3d rot = mat.topLeftCorner<3, 3>();
+            return mat.row(3).isApprox(Eigen::RowVector4d(0, 0, 0, 1),
+                                       TOLERANCE) &&
+                   rot.isUnitary(TOLERANCE) && rot.determinant() > 0;
+        }
+
+        void m_compile(Transform const &xform) {
+            auto const &pre = xform.getPre();
+            auto const &post = xform.getPost();
+            m_general = xform;
+            m_identity = pre.isIdentity() && post.isIdentity();
+            m_rigid = m_isRigid(pre) && m_isRigid(post);
+            m_linear = post.topLeftCorner<3, 3>() *
+                       pre.topLeftCorner<3, 3>().transpose();
+            if (m_rigid) {
+                m_preRot = Eigen::Quaterniond(
+                                 Eigen::Matrix3d(pre.topLeftCorner<3, 3>()))
+                                 .normalized();
+                m_preTrans = pre.topRightCorner<3, 1>();
+                m_postRot = Eigen::Quaterniond(
+                                  Eigen::Matrix3d(post.topLeftCorner<3, 3>()))
+                                  .normalized();
+                m_postTrans = post.topRightCorner<3, 1>();
+            } else {
+                m_preRot = m_postRot = Eigen::Quaterniond::Identity();
+                m_preTrans = m_postTrans = Eigen::Vector3d::Zero();
+            }
+        }
+
+        bool m_identity;
+        bool m_rigid;
+        Eigen::Quaterniond m_preRot;
+        Eigen::Vector3d m_preTrans;
+        Eigen::Quaterniond m_postRot;
+        Eigen::Vector3d m_postTrans;
+        Eigen::Matrix3d m_linear;
+        Transform m_general;
+    };
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_CompiledTransform_h_GUID_FE3A6E98_3B92_4D1C_B5DC_7876DB7C999E
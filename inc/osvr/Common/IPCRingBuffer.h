@@ -60,8 +60,12 @@ namespace common {
     /// Designed to provide large-format data transfer in single-producer,
     /// roughly broadcast model, with an outside channel for communicating the
     /// segment name and signalling new data, and no guarantee that the data you
-    /// were notified about won't be overwritten - just that if you're currently
-    /// accessing data, we won't overwrite that.
+    /// were notified about won't be overwritten.
+    ///
+    /// Entries are protected by sequence locks rather than mutexes: readers
+    /// copy an entry out and check that it wasn't modified meanwhile, so they
+    /// never block the writer (and a stalled or crashed reader can't), at the
+    /// cost of failing to get an entry that is overwritten while being read.
     class IPCRingBuffer : public enable_shared_from_this<IPCRingBuffer> {
       public:
         typedef uint8_t BackendType;
@@ -155,8 +159,9 @@ namespace common {
         typedef shared_ptr<value_type> smart_pointer_type;
 
         /// @brief A class providing write access to the next available element
-        /// in the ring buffer, owning the appropriate mutex locks and providing
-        /// access to the sequence number.
+        /// in the ring buffer and access to the sequence number. The element
+        /// is published (and readers can get it) once this object is
+        /// destroyed, unless abort() was called.
         class BufferWriteProxy {
           public:
             /// @brief not copyable
@@ -166,12 +171,16 @@ namespace common {
             BufferWriteProxy &operator=(BufferWriteProxy const &) = delete;
 
             /// @brief move-constructible
-            BufferWriteProxy(BufferWriteProxy &&other) {
-                std::swap(m_data, other.m_data);
+            BufferWriteProxy(BufferWriteProxy &&other)
+                : m_buf(other.m_buf), m_seq(other.m_seq),
+                  m_data(std::move(other.m_data)) {
+                other.m_buf = nullptr;
             }
 
             /// @brief move-assignable
             BufferWriteProxy &operator=(BufferWriteProxy &&other) {
+                std::swap(m_buf, other.m_buf);
+                std::swap(m_seq, other.m_seq);
                 std::swap(m_data, other.m_data);
                 return *this;
             }
@@ -182,6 +191,11 @@ namespace common {
 
             sequence_type getSequenceNumber() const { return m_seq; }
 
+            /// @brief Gives up on this element without publishing it: readers
+            /// never see whatever was written to it, and the next put()
+            /// reuses its sequence number. Leaves this object empty.
+            OSVR_COMMON_EXPORT void abort();
+
           private:
             BufferWriteProxy(detail::IPCPutResultPtr &&data,
                              IPCRingBufferPtr &&shm);
@@ -191,9 +205,9 @@ namespace common {
             detail::IPCPutResultPtr m_data;
         };
 
-        /// @brief A class providing access to an entry in the ring buffer,
-        /// holding a sharable mutex lock preventing it from being overwritten
-        /// while this object is in scope.
+        /// @brief A class providing access to a consistent copy of an entry in
+        /// the ring buffer, owned by this object (and any smart pointers
+        /// obtained from it).
         ///
         /// As such, you should only access the memory pointed to by this object
         /// while you keep this object alive, and you should let it go out of
@@ -239,10 +253,13 @@ namespace common {
         /// the buffer. You're responsible for doing the copying and, once you
         /// let the returned object exit scope, the notification (possibly with
         /// sequence number)
+        ///
+        /// Only one thread/process may write to a given ring buffer.
         OSVR_COMMON_EXPORT BufferWriteProxy put();
 
-        /// @brief Gets access to an element in the buffer by sequence number:
-        /// returns a proxy object  that behaves mostly like a smart pointer.
+        /// @brief Gets a copy of an element in the buffer by sequence number:
+        /// returns a proxy object  that behaves mostly like a smart pointer,
+        /// and is empty if that element is no longer (or not yet) available.
         OSVR_COMMON_EXPORT BufferReadProxy get(sequence_type num);
 
         /// @brief Gets access to the most recent element in the buffer: returns
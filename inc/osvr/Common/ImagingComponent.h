@@ -33,12 +33,15 @@
 #include <osvr/Util/ImagingReportTypesC.h>
 #include <osvr/Common/IPCRingBuffer.h>
 #include <osvr/Common/ImagingComponentConfig.h>
+#include <osvr/Common/ImagingWireFormat.h>
+#include <osvr/Util/AlignedMemoryUniquePtr.h>
+#include <osvr/Util/TimeValue.h>
 
 // Library/third-party includes
 #include <vrpn_BaseClass.h>
 
 // Standard includes
-// - none
+#include <vector>
 
 namespace osvr {
 namespace common {
@@ -53,6 +56,19 @@ namespace common {
           public:
             class MessageSerialization;
 
+            static const char *identifier();
+        };
+        class ImageFragment : public MessageRegistration<ImageFragment> {
+          public:
+            class MessageSerialization;
+
+            static const char *identifier();
+        };
+        class NetworkStreamRequest
+            : public MessageRegistration<NetworkStreamRequest> {
+          public:
+            class MessageSerialization;
+
             static const char *identifier();
         };
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
@@ -82,8 +98,18 @@ namespace common {
         create(OSVR_ChannelCount numSensor = 0);
 
         /// @brief Message from server to client, containing some image data.
+        /// No longer sent, but still handled for the sake of older servers.
         messages::ImageRegion imageRegion;
 
+        /// @brief Message from server to client, containing a piece of a
+        /// (possibly cropped, downscaled, and/or compressed) frame.
+        messages::ImageFragment imageFragment;
+
+        /// @brief Message from client to server, asking for frames to be sent
+        /// over the network (for a while) rather than only through shared
+        /// memory.
+        messages::NetworkStreamRequest networkStreamRequest;
+
         /// @brief Message from server to client, notifying of image data in the
         /// shared memory ring buffer.
         messages::ImagePlacedInSharedMemory imagePlacedInSharedMemory;
@@ -98,6 +124,45 @@ namespace common {
             OSVR_ImagingMetadata metadata, OSVR_ImageBufferElement *imageData,
             OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp);
 
+        /// @brief Lends a writable buffer, large enough for an image described
+        /// by @p metadata, for the given sensor: when possible, this is an
+        /// entry of the shared-memory ring buffer itself (or, with in-process
+        /// imaging, a buffer whose ownership is passed along), so the frame
+        /// can be written in place without a copy in sendImageData().
+        ///
+        /// Only one buffer may be outstanding per sensor: acquiring again
+        /// before committing discards the previous buffer. Does not pack
+        /// messages, so it does not require the send guard - but it must be
+        /// called on the same thread as commitImageBuffer().
+        ///
+        /// @return nullptr if no buffer could be provided.
+        OSVR_COMMON_EXPORT OSVR_ImageBufferElement *
+        acquireImageBuffer(OSVR_ImagingMetadata const &metadata,
+                           OSVR_ChannelCount sensor);
+
+        /// @brief Sends the frame written into the buffer most recently
+        /// acquired for this sensor, releasing that buffer. Requires the send
+        /// guard, like sendImageData().
+        ///
+        /// @return false if there was no outstanding buffer for the sensor.
+        OSVR_COMMON_EXPORT bool
+        commitImageBuffer(OSVR_ChannelCount sensor,
+                          OSVR_TimeValue const &timestamp);
+
+        /// @brief Releases the outstanding acquired buffer for this sensor, if
+        /// any, without sending it.
+        OSVR_COMMON_EXPORT void discardImageBuffer(OSVR_ChannelCount sensor);
+
+        /// @brief Client side: ask the server for frames over the network
+        /// with the given options, whether or not shared memory is usable.
+        ///
+        /// Without calling this, a client with image handlers requests the
+        /// full frames, uncompressed, only while it isn't receiving them
+        /// through shared memory. Requests are broadcast, so if several remote
+        /// clients ask for different options, the most recent request wins.
+        OSVR_COMMON_EXPORT void
+        requestNetworkStream(NetworkImagingOptions const &options);
+
         typedef std::function<void(ImageData const &,
                                    util::time::TimeValue const &)> ImageHandler;
         OSVR_COMMON_EXPORT void registerImageHandler(ImageHandler cb);
@@ -105,6 +170,7 @@ namespace common {
       private:
         ImagingComponent(OSVR_ChannelCount numChan);
         virtual void m_parentSet();
+        virtual void m_update();
 
         /// @return true if we could send it.
         bool m_sendImageDataViaSharedMemory(OSVR_ImagingMetadata metadata,
@@ -112,6 +178,9 @@ namespace common {
                                             OSVR_ChannelCount sensor,
                                             OSVR_TimeValue const &timestamp);
 
+        /// @brief Sends the frame (as a series of fragments) to remote
+        /// clients, if any have asked for it recently.
+        ///
         /// @return true if we could send it.
         bool m_sendImageDataOnTheWire(OSVR_ImagingMetadata metadata,
                                       OSVR_ImageBufferElement *imageData,
@@ -124,14 +193,49 @@ namespace common {
                                                OSVR_ImageBufferElement *imageData,
                                                OSVR_ChannelCount sensor,
                                                OSVR_TimeValue const &timestamp);
+
+        /// @brief Sends a notification handing off ownership of an aligned
+        /// buffer already containing the image.
+        void m_sendInProcessBuffer(OSVR_ImagingMetadata metadata,
+                                   util::AlignedImageBufferPtr &&buffer,
+                                   OSVR_ChannelCount sensor,
+                                   OSVR_TimeValue const &timestamp);
 #endif
 
+        /// @brief Creates or replaces the shared memory ring buffer for the
+        /// sensor if required to hold entries of the given size.
+        /// @return nullptr if the ring buffer could not be created.
+        IPCRingBuffer *m_ensureShmBuf(OSVR_ChannelCount sensor,
+                                      uint32_t entrySize);
+
+        /// @brief Sends the notification that an image has been placed in the
+        /// shared memory ring buffer with the given sequence number.
+        void m_sendSharedMemoryNotice(OSVR_ImagingMetadata metadata,
+                                      IPCRingBuffer &shm,
+                                      IPCRingBuffer::sequence_type seq,
+                                      OSVR_ChannelCount sensor,
+                                      OSVR_TimeValue const &timestamp);
+
         static int VRPN_CALLBACK
         m_handleImageRegion(void *userdata, vrpn_HANDLERPARAM p);
 
         static int VRPN_CALLBACK
         m_handleImagePlacedInSharedMemory(void *userdata, vrpn_HANDLERPARAM p);
 
+        static int VRPN_CALLBACK
+        m_handleImageFragment(void *userdata, vrpn_HANDLERPARAM p);
+
+        static int VRPN_CALLBACK
+        m_handleNetworkStreamRequest(void *userdata, vrpn_HANDLERPARAM p);
+
+        /// @brief Server side: has a client asked for network frames recently
+        /// enough?
+        bool m_networkStreamRequested() const;
+
+        /// @brief Client side: does this client currently need network
+        /// frames?
+        bool m_needNetworkStream(util::time::TimeValue const &now) const;
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         static int VRPN_CALLBACK
         m_handleImagePlacedInProcessMemory(void *userdata, vrpn_HANDLERPARAM p);
@@ -145,6 +249,79 @@ namespace common {
         bool m_gotOne;
         /// @brief One for each sensor
         std::vector<IPCRingBufferPtr> m_shmBuf;
+
+        /// @brief A buffer lent out by acquireImageBuffer() and not yet
+        /// committed: either a write-locked ring buffer entry or an owned
+        /// aligned buffer.
+        struct PendingImage {
+            OSVR_ImagingMetadata metadata;
+            OSVR_ImageBufferElement *buffer = nullptr;
+            unique_ptr<IPCRingBuffer::BufferWriteProxy> shmEntry;
+            util::AlignedImageBufferPtr ownedBuffer;
+
+            /// @brief Lets go of the buffer without sending it: in
+            /// particular, a ring buffer entry is aborted rather than
+            /// published, since it may hold a partial (or no) image.
+            void discard() {
+                if (shmEntry) {
+                    shmEntry->abort();
+                }
+                *this = PendingImage{};
+            }
+        };
+        /// @brief One for each sensor
+        std::vector<PendingImage> m_pending;
+
+        /// @brief Network stream options: requested, on the client side, or
+        /// being served, on the server side.
+        NetworkImagingOptions m_networkOptions;
+
+        /// @name Server-side network stream state
+        /// @{
+        bool m_networkRequested = false;
+        util::time::TimeValue m_networkRequestReceived;
+        struct SentFrames {
+            uint32_t frame = 0;
+            uint32_t sinceKeyframe = 0;
+            bool haveLast = false;
+            OSVR_ImagingMetadata lastMetadata;
+            /// @brief The last frame sent, as a reference for the next.
+            ImageBytes last;
+            ImageBytes region;
+            ImageBytes encoded;
+        };
+        /// @brief One for each sensor
+        std::vector<SentFrames> m_sent;
+        /// @}
+
+        /// @name Client-side network stream state
+        /// @{
+        bool m_forceNetworkStream = false;
+        bool m_networkRequestDirty = true;
+        util::time::TimeValue m_networkRequestSent;
+        /// @brief When the last frame arrived through shared (or in-process)
+        /// memory, or when the first handler was registered.
+        util::time::TimeValue m_lastSharedMemoryActivity;
+        /// @brief Set when a shared memory notice couldn't be used.
+        bool m_sharedMemoryUnusable = false;
+        struct ReceivedFrames {
+            bool assembling = false;
+            uint32_t frame = 0;
+            /// @brief Metadata and fragment count of the frame being
+            /// assembled, as given by its first fragment.
+            OSVR_ImagingMetadata metadata = {};
+            uint16_t fragmentCount = 0;
+            uint16_t fragmentsReceived = 0;
+            ImageBytes encoded;
+            bool haveLast = false;
+            uint32_t lastFrame = 0;
+            /// @brief The last frame decoded, as a reference for the next.
+            ImageBytes last;
+            ImageBytes decoded;
+        };
+        /// @brief One for each sensor
+        std::vector<ReceivedFrames> m_received;
+        /// @}
     };
 } // namespace common
 } // namespace osvr
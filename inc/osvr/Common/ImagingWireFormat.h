@@ -0,0 +1,121 @@
+/** @file
+    @brief Header for the pieces of the network (non-shared-memory) imaging
+    transport that don't depend on a connection: region selection,
+    downscaling, and lossless compression of frames.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ImagingWireFormat_h_GUID_EA45112D_CA73_432C_B00F_585733D4E64A
+#define INCLUDED_ImagingWireFormat_h_GUID_EA45112D_CA73_432C_B00F_585733D4E64A
+
+// Internal Includes
+#include <osvr/Common/Export.h>
+#include <osvr/Util/ImagingReportTypesC.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace osvr {
+namespace common {
+    typedef std::vector<OSVR_ImageBufferElement> ImageBytes;
+
+    /// @brief What a client wants sent over the network for an imaging
+    /// device, if it can't use shared memory.
+    struct NetworkImagingOptions {
+        /// @brief Region of interest, in source image pixels. A zero width or
+        /// height means the full extent of the image in that dimension.
+        OSVR_ImageDimension roiX = 0;
+        OSVR_ImageDimension roiY = 0;
+        OSVR_ImageDimension roiWidth = 0;
+        OSVR_ImageDimension roiHeight = 0;
+        /// @brief Keep only every nth pixel of every nth row of the region.
+        uint8_t downscale = 1;
+        /// @brief Whether to compress frames (losslessly).
+        bool compress = false;
+    };
+
+    inline bool operator==(NetworkImagingOptions const &a,
+                           NetworkImagingOptions const &b) {
+        return a.roiX == b.roiX && a.roiY == b.roiY &&
+               a.roiWidth == b.roiWidth && a.roiHeight == b.roiHeight &&
+               a.downscale == b.downscale && a.compress == b.compress;
+    }
+
+    inline bool operator!=(NetworkImagingOptions const &a,
+                           NetworkImagingOptions const &b) {
+        return !(a == b);
+    }
+
+    /// @brief How the bytes of a frame sent over the network are encoded.
+    enum class ImageWireEncoding : uint8_t {
+        /// @brief The pixels as-is.
+        Raw = 0,
+        /// @brief Run-length encoded pixels.
+        RunLength = 1,
+        /// @brief Run-length encoded bytewise difference from the previous
+        /// frame sent.
+        DeltaRunLength = 2
+    };
+
+    /// @brief Copies the region of interest out of an image, downscaling it
+    /// as requested.
+    ///
+    /// The region is clamped to the image, and an empty result falls back to
+    /// the whole image.
+    ///
+    /// @return the metadata describing the extracted image.
+    OSVR_COMMON_EXPORT OSVR_ImagingMetadata extractImageRegion(
+        OSVR_ImagingMetadata const &metadata,
+        OSVR_ImageBufferElement const *data,
+        NetworkImagingOptions const &options, ImageBytes &out);
+
+    /// @brief Encodes a frame for the wire, using the previous frame sent (if
+    /// provided and the same size) as a reference. Falls back to a less
+    /// compressed encoding if compression would not reduce the size.
+    ///
+    /// @return the encoding used for @p out
+    OSVR_COMMON_EXPORT ImageWireEncoding
+    encodeImageForWire(ImageBytes const &image, ImageBytes const *previous,
+                       ImageBytes &out);
+
+    /// @brief Decodes a frame from the wire into @p out, which must already
+    /// have the size of the decoded frame.
+    ///
+    /// @param previous The previous frame decoded, required for
+    /// ImageWireEncoding::DeltaRunLength.
+    ///
+    /// @return false if the data was malformed or did not decode to exactly
+    /// the expected size, or a required previous frame was missing.
+    OSVR_COMMON_EXPORT bool
+    decodeImageFromWire(ImageWireEncoding encoding,
+                        OSVR_ImageBufferElement const *data, std::size_t len,
+                        ImageBytes const *previous, ImageBytes &out);
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ImagingWireFormat_h_GUID_EA45112D_CA73_432C_B00F_585733D4E64A
@@ -0,0 +1,136 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_InProcessReports_h_GUID_BBABFFBC_4AF8_457C_91D9_8488F14F543F
+#define INCLUDED_InProcessReports_h_GUID_BBABFFBC_4AF8_457C_91D9_8488F14F543F
+
+// Internal Includes
+#include <osvr/Common/Export.h>
+#include <osvr/Common/InProcessReportsPtr.h>
+#include <osvr/Util/ChannelCountC.h>
+#include <osvr/Util/ClientReportTypesC.h>
+#include <osvr/Util/TimeValue.h>
+#include <osvr/Util/UniquePtr.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace osvr {
+namespace common {
+    /// @brief Interface for receiving a tracker device's reports, as the
+    /// device sent them (before any transform), within the server process.
+    class TrackerReportListener {
+      public:
+        OSVR_COMMON_EXPORT virtual ~TrackerReportListener();
+        virtual void handlePose(OSVR_ChannelCount sensor,
+                                OSVR_PoseState const &pose,
+                                util::time::TimeValue const &timestamp) = 0;
+        virtual void
+        handleVelocity(OSVR_ChannelCount sensor, OSVR_VelocityState const &vel,
+                       util::time::TimeValue const &timestamp) = 0;
+        virtual void
+        handleAcceleration(OSVR_ChannelCount sensor,
+                           OSVR_AccelerationState const &accel,
+                           util::time::TimeValue const &timestamp) = 0;
+    };
+
+    /// @brief Delivers the tracker reports of one device directly to
+    /// listeners in the same process, as typed structs.
+    class InProcessTrackerChannel : boost::noncopyable {
+      public:
+        /// @name Publisher side
+        /// @{
+        /// @brief Records that a device is publishing on this channel, so
+        /// listeners need not also receive its reports over the network.
+        OSVR_COMMON_EXPORT void attachPublisher();
+        OSVR_COMMON_EXPORT void detachPublisher();
+        /// @brief Whether anyone would hear a report: when false, publishers
+        /// can skip building one.
+        bool hasListeners() const { return !m_listeners.empty(); }
+        OSVR_COMMON_EXPORT void
+        publishPose(OSVR_ChannelCount sensor, OSVR_PoseState const &pose,
+                    util::time::TimeValue const &timestamp);
+        OSVR_COMMON_EXPORT void
+        publishVelocity(OSVR_ChannelCount sensor, OSVR_VelocityState const &vel,
+                        util::time::TimeValue const &timestamp);
+        OSVR_COMMON_EXPORT void
+        publishAcceleration(OSVR_ChannelCount sensor,
+                            OSVR_AccelerationState const &accel,
+                            util::time::TimeValue const &timestamp);
+        /// @}
+
+        /// @name Listener side
+        /// @{
+        /// @brief Whether a device is currently publishing on this channel.
+        bool hasPublisher() const { return m_publishers > 0; }
+        OSVR_COMMON_EXPORT void addListener(TrackerReportListener &listener);
+        OSVR_COMMON_EXPORT void
+        removeListener(TrackerReportListener &listener);
+        /// @}
+
+      private:
+        /// @brief Calls @p f with each listener, such that listeners removed
+        /// meanwhile (even from within @p f) are skipped without disturbing
+        /// the rest.
+        template <typename F> void m_forEachListener(F &&f);
+
+        std::size_t m_publishers = 0;
+        std::vector<TrackerReportListener *> m_listeners;
+        /// @brief How many publish calls are in progress: while non-zero,
+        /// removed listeners are only nulled out, then dropped afterwards.
+        std::size_t m_publishDepth = 0;
+    };
+
+    /// @brief A hub, owned by the server's connection, through which devices
+    /// hand their reports straight to analysis plugins in the same process,
+    /// skipping serialization and the loop back through the network
+    /// connection. External clients still get the reports over the network.
+    ///
+    /// Not internally synchronized: everything here must happen on the
+    /// server's main thread, or on a device thread while it holds the main
+    /// thread for sending (as async device tokens do, unless they queue
+    /// their data - so queued devices, batching ones included, don't publish
+    /// here).
+    class InProcessReports : boost::noncopyable {
+      public:
+        /// @brief Gets (creating if needed) the tracker channel for a device,
+        /// named as in the path tree (plugin name and device name, without a
+        /// host). The reference stays valid as long as this object does.
+        OSVR_COMMON_EXPORT InProcessTrackerChannel &
+        getTrackerChannel(std::string const &deviceName);
+
+      private:
+        std::unordered_map<std::string, unique_ptr<InProcessTrackerChannel> >
+            m_trackers;
+    };
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_InProcessReports_h_GUID_BBABFFBC_4AF8_457C_91D9_8488F14F543F
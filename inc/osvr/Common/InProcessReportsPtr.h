@@ -0,0 +1,46 @@
+/** @file
+    @brief Header forward-declaring InProcessReports and specifying the
+   smart pointer type to hold it.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_InProcessReportsPtr_h_GUID_C6DC2C0D_41DF_419B_A957_5687473C7047
+#define INCLUDED_InProcessReportsPtr_h_GUID_C6DC2C0D_41DF_419B_A957_5687473C7047
+
+// Internal Includes
+#include <osvr/Util/SharedPtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    class InProcessReports;
+    /// @brief Pointer for holding an InProcessReports hub.
+    typedef shared_ptr<InProcessReports> InProcessReportsPtr;
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_InProcessReportsPtr_h_GUID_C6DC2C0D_41DF_419B_A957_5687473C7047
@@ -33,12 +33,13 @@
 #include <osvr/Common/Tracing.h>
 #include <osvr/TypePack/TypeKeyedTuple.h>
 #include <osvr/TypePack/Quote.h>
+#include <osvr/Util/SeqLock.h>
 
 // Library/third-party includes
-#include <boost/optional.hpp>
+// - none
 
 // Standard includes
-// - none
+#include <atomic>
 
 namespace osvr {
 namespace common {
@@ -50,60 +51,123 @@ namespace common {
         util::time::TimeValue timestamp;
     };
 
-    /// @brief Alias taking a report type and returning a state map
-    /// value type.
+    /// @brief Alias taking a report type and returning a lock-free snapshot
+    /// of the latest state.
     template <typename ReportType>
-    using StateMapValueType = boost::optional<StateMapContents<ReportType>>;
+    using StateSnapshot = util::SeqLock<StateMapContents<ReportType>>;
 
-    /// @brief Data structure mapping from a report type to an optional state
-    /// value.
-    using StateMap =
+    /// @brief Data structure mapping from a report type to a snapshot of the
+    /// latest state value.
+    using StateSnapshotMap =
         typepack::TypeKeyedTuple<traits::ReportTypeList,
-                                 typepack::quote<StateMapValueType>>;
+                                 typepack::quote<StateSnapshot>>;
+
+    /// @brief The latest pose and velocity of an interface, kept side by
+    /// side so they can be read as one consistent pair for extrapolation.
+    struct MotionState {
+        bool hasPose;
+        util::time::TimeValue poseTimestamp;
+        OSVR_PoseState pose;
+        bool hasVelocity;
+        util::time::TimeValue velocityTimestamp;
+        OSVR_VelocityState velocity;
+    };
 
     /// @brief Class to maintain state for an interface for each report (and
     /// thus state) type explicitly enumerated.
+    ///
+    /// State is set from a single thread (the one running the client
+    /// context's update), but may be read from any thread without locking:
+    /// readers always see the complete newest state.
     class InterfaceState {
       public:
         template <typename ReportType>
         void setStateFromReport(util::time::TimeValue const &timestamp,
                                 ReportType const &report) {
-            if (hasState<ReportType>()) {
-                auto &oldTimestamp =
-                    typepack::cget<ReportType, StateMap>(m_states)->timestamp;
-                if (osvrTimeValueGreater(oldTimestamp, timestamp)) {
-                    tracing::markTimestampOutOfOrder();
-                    return;
-                }
-            }
+            auto &snapshot = typepack::get<ReportType>(m_states);
             StateMapContents<ReportType> c;
+            // We're the only writer, so this read can't race.
+            if (snapshot.load(c) &&
+                osvrTimeValueGreater(c.timestamp, timestamp)) {
+                tracing::markTimestampOutOfOrder();
+                return;
+            }
             c.state = reportState(report);
             c.timestamp = timestamp;
-            typepack::get<ReportType, StateMap>(m_states) = c;
-            m_hasState = true;
+            snapshot.store(c);
+            m_updateMotion(timestamp, report);
+            m_hasState.store(true, std::memory_order_release);
         }
 
         template <typename ReportType> bool hasState() const {
-            // using typepack::get;
-            return m_hasState && bool(typepack::cget<ReportType>(m_states));
+            return typepack::cget<ReportType>(m_states).hasValue();
         }
 
-        bool hasAnyState() const { return m_hasState; }
+        bool hasAnyState() const {
+            return m_hasState.load(std::memory_order_acquire);
+        }
 
+        /// @brief Copies out the latest state, if any, for the report type.
+        /// May be called from any thread.
+        ///
+        /// @return true if there was state to copy.
         template <typename ReportType>
-        void getState(util::time::TimeValue &timestamp,
+        bool getState(util::time::TimeValue &timestamp,
                       traits::StateFromReport_t<ReportType> &state) const {
-            if (hasState<ReportType>()) {
-                timestamp = typepack::cget<ReportType>(m_states)->timestamp;
-                state = typepack::cget<ReportType>(m_states)->state;
+            StateMapContents<ReportType> c;
+            if (!typepack::cget<ReportType>(m_states).load(c)) {
+                return false;
             }
-            /// @todo do we fail silently or throw exception if we are asked for
-            /// state we don't have?
+            timestamp = c.timestamp;
+            state = c.state;
+            return true;
+        }
+
+        /// @brief Copies out the latest pose and velocity together, so that
+        /// neither can be replaced in between. May be called from any
+        /// thread.
+        ///
+        /// @return true if there was a pose or velocity to copy.
+        bool getMotionState(MotionState &motion) const {
+            return m_motion.load(motion);
         }
 
       private:
-        StateMap m_states;
-        bool m_hasState = false;
+        template <typename ReportType>
+        void m_updateMotion(util::time::TimeValue const &,
+                            ReportType const &) {}
+
+        void m_updateMotion(util::time::TimeValue const &timestamp,
+                            OSVR_PoseReport const &report) {
+            auto motion = m_loadMotion();
+            motion.hasPose = true;
+            motion.poseTimestamp = timestamp;
+            motion.pose = report.pose;
+            m_motion.store(motion);
+        }
+
+        void m_updateMotion(util::time::TimeValue const &timestamp,
+                            OSVR_VelocityReport const &report) {
+            auto motion = m_loadMotion();
+            motion.hasVelocity = true;
+            motion.velocityTimestamp = timestamp;
+            motion.velocity = report.state;
+            m_motion.store(motion);
+        }
+
+        MotionState m_loadMotion() const {
+            MotionState motion;
+            // We're the only writer, so this read can't race.
+            if (!m_motion.load(motion)) {
+                motion.hasPose = false;
+                motion.hasVelocity = false;
+            }
+            return motion;
+        }
+
+        StateSnapshotMap m_states;
+        util::SeqLock<MotionState> m_motion;
+        std::atomic<bool> m_hasState{false};
     };
 
 } // namespace common
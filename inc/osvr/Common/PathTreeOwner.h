@@ -36,6 +36,8 @@
 
 // Standard includes
 #include <vector>
+#include <string>
+#include <cstdint>
 
 namespace osvr {
 namespace common {
@@ -69,6 +71,30 @@ namespace common {
         /// serialized array of nodes.
         OSVR_COMMON_EXPORT void replaceTree(Json::Value const &nodes);
 
+        /// @brief Apply a versioned set of changes (as sent with
+        /// SystemComponent::sendTreeDelta() ) to the path tree.
+        ///
+        /// A message with "nodes" replaces the whole tree, unless it is
+        /// already at that version. One without a base version is just a stamp
+        /// to check the current version against. Deltas are only applied if
+        /// their base version matches the current tree's version.
+        ///
+        /// @return false if the tree is out of date or was left out of date,
+        /// so a full tree should be requested from the server.
+        OSVR_COMMON_EXPORT bool applyTreeDelta(Json::Value const &delta);
+
+        /// @brief Gets a number that changes every time the tree is replaced
+        /// entirely (rather than updated in place by a delta), invalidating
+        /// any pointers to its nodes.
+        std::uint64_t getGeneration() const { return m_generation; }
+
+        /// @brief Gets the full paths of the nodes changed (added, changed,
+        /// or removed) by the most recent delta. Empty if the most recent
+        /// update was a full replacement.
+        std::vector<std::string> const &getLastDeltaPaths() const {
+            return m_lastDeltaPaths;
+        }
+
         /// @brief Access the path tree object itself
         PathTree &get() { return m_tree; }
 
@@ -79,6 +105,10 @@ namespace common {
         PathTree m_tree;
         std::vector<PathTreeObserverWeakPtr> m_observers;
         bool m_valid = false;
+        bool m_versionKnown = false;
+        std::uint64_t m_version = 0;
+        std::uint64_t m_generation = 0;
+        std::vector<std::string> m_lastDeltaPaths;
     };
 } // namespace common
 } // namespace osvr
@@ -35,6 +35,7 @@
 
 // Standard includes
 #include <string>
+#include <vector>
 
 namespace osvr {
 namespace common {
@@ -49,6 +50,30 @@ namespace common {
 
     /// @brief Deserialize a path tree from a JSON array of objects
     OSVR_COMMON_EXPORT void jsonToPathTree(PathTree &tree, Json::Value nodes);
+
+    /// @brief Compute the difference between two path trees, each serialized
+    /// as by pathTreeToJson().
+    ///
+    /// @return a JSON object with "added" and "changed" arrays of serialized
+    /// nodes (as found in @p newNodes) and a "removed" array of paths.
+    OSVR_COMMON_EXPORT Json::Value diffPathTreeJson(Json::Value const &oldNodes,
+                                                    Json::Value const &newNodes);
+
+    /// @brief Returns true if a difference computed by diffPathTreeJson()
+    /// contains no changes.
+    OSVR_COMMON_EXPORT bool isPathTreeDeltaEmpty(Json::Value const &delta);
+
+    /// @brief Apply a difference computed by diffPathTreeJson() to a path
+    /// tree in place.
+    ///
+    /// Removed nodes are pruned from the tree, along with any ancestors left
+    /// null and childless. A removed node that still has children just has
+    /// its value reset to null.
+    ///
+    /// @return the full paths of the nodes pruned, which invalidates any
+    /// references to them.
+    OSVR_COMMON_EXPORT std::vector<std::string>
+    applyPathTreeDelta(PathTree &tree, Json::Value const &delta);
 } // namespace common
 } // namespace osvr
 
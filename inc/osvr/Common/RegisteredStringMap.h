@@ -33,6 +33,8 @@
 #include <json/value.h>
 
 // Standard includes
+#include <cstddef>
+#include <string>
 #include <vector>
 
 namespace osvr {
@@ -40,6 +42,10 @@ namespace common {
 
     /// Centralize a string registry. Basically, the server side, and part
     /// of the client side internals.
+    ///
+    /// IDs are indices into the entry vector, so they are stable for the life
+    /// of the map; an open-addressing hash index over that vector makes
+    /// lookups constant-time on average.
     class RegisteredStringMap {
       public:
         /// retrieve the ID for the current name or register new ID and return
@@ -64,6 +70,20 @@ namespace common {
 
         /// special flag that gets switched whenever new element is inserted;
         bool m_modified = false;
+
+      private:
+        /// @brief Returns the index slot that holds, or would hold, a string
+        /// with the given hash and contents.
+        std::size_t m_findSlot(std::size_t hash, std::string const &str) const;
+        /// @brief Doubles the hash index and re-inserts all entries.
+        void m_growIndex();
+
+        /// Hash of each entry, parallel to m_regEntries, so growing the index
+        /// never re-hashes strings.
+        std::vector<std::size_t> m_hashes;
+        /// Open-addressing (linear probing) table of entry index + 1, with 0
+        /// marking an empty slot. Size is always zero or a power of two.
+        std::vector<uint32_t> m_index;
     };
 
     /// This is like a RegisteredStringMap, except it also knows that some peer
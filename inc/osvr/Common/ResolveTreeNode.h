@@ -35,6 +35,7 @@
 
 // Standard includes
 #include <string>
+#include <vector>
 
 namespace osvr {
 namespace common {
@@ -42,6 +43,16 @@ namespace common {
     OSVR_COMMON_EXPORT boost::optional<OriginalSource>
     resolveTreeNode(PathTree &pathTree, std::string const &path);
 
+    /// @overload
+    ///
+    /// Also appends to @p dependencies the full path of every node visited
+    /// while following aliases, ending with the node the resolution landed
+    /// on. Along with their ancestors (where the device and interface are
+    /// found), these are the only nodes the result depends on.
+    OSVR_COMMON_EXPORT boost::optional<OriginalSource>
+    resolveTreeNode(PathTree &pathTree, std::string const &path,
+                    std::vector<std::string> &dependencies);
+
 } // namespace common
 } // namespace osvr
 
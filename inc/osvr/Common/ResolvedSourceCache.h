@@ -0,0 +1,85 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ResolvedSourceCache_h_GUID_0AA55E78_389F_4050_8A72_D0F8428C235B
+#define INCLUDED_ResolvedSourceCache_h_GUID_0AA55E78_389F_4050_8A72_D0F8428C235B
+
+// Internal Includes
+#include <osvr/Common/Export.h>
+#include <osvr/Common/PathTree_fwd.h>
+#include <osvr/Common/OriginalSource.h>
+
+// Library/third-party includes
+#include <boost/optional.hpp>
+
+// Standard includes
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace osvr {
+namespace common {
+    /// @brief Memoizes resolveTreeNode() results for a path tree, tracking
+    /// which nodes each result depended on so that a change to one node only
+    /// invalidates the results that passed through it.
+    ///
+    /// Cached sources point into the tree, so the cache must be cleared when
+    /// the tree is replaced or reset, and told about every node changed in
+    /// place.
+    class ResolvedSourceCache {
+      public:
+        /// @brief Resolve the path to its original source, using the cached
+        /// result if there is one (whether or not it resolved).
+        OSVR_COMMON_EXPORT boost::optional<OriginalSource> const &
+        resolve(PathTree &tree, std::string const &path);
+
+        /// @brief Is there a cached result for this path?
+        OSVR_COMMON_EXPORT bool contains(std::string const &path) const;
+
+        /// @brief Drop all cached results.
+        OSVR_COMMON_EXPORT void clear();
+
+        /// @brief Drop the cached results that depended on the node at the
+        /// given (full) path, including those that depended on a descendant.
+        ///
+        /// @return the number of results dropped.
+        OSVR_COMMON_EXPORT std::size_t invalidate(std::string const &path);
+
+      private:
+        struct Entry {
+            boost::optional<OriginalSource> source;
+            std::vector<std::string> dependencies;
+        };
+        std::unordered_map<std::string, Entry> m_entries;
+        /// @brief Maps every dependency, and every ancestor of a dependency,
+        /// to the paths of the cached results that depend on it. May contain
+        /// paths no longer cached.
+        std::unordered_map<std::string, std::unordered_set<std::string> >
+            m_dependents;
+    };
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ResolvedSourceCache_h_GUID_0AA55E78_389F_4050_8A72_D0F8428C235B
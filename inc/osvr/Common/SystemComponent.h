@@ -69,6 +69,19 @@ namespace common {
             class MessageSerialization;
             static const char *identifier();
         };
+
+        class TreeDeltaFromServer
+            : public MessageRegistration<TreeDeltaFromServer> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
+
+        class TreeRequestToServer
+            : public MessageRegistration<TreeRequestToServer> {
+          public:
+            static const char *identifier();
+        };
     } // namespace messages
 
     /// @brief BaseDevice component, to be used only with the "OSVR" special
@@ -112,13 +125,49 @@ namespace common {
 
         OSVR_COMMON_EXPORT void sendReplacementTree(PathTree &tree);
 
+        /// @overload
+        ///
+        /// Takes a tree already serialized with pathTreeToJson()
+        OSVR_COMMON_EXPORT void
+        sendReplacementTree(Json::Value const &nodes);
+
+        /// @brief Message from server, applying a versioned set of changes
+        /// (as from diffPathTreeJson()) to the client's configuration.
+        ///
+        /// The object also contains a "version" member, and a "baseVersion"
+        /// member naming the version the changes apply to. A message with no
+        /// "baseVersion" instead either carries the whole tree of that
+        /// version, as a "nodes" array, or just announces the version, so
+        /// clients can tell whether they need to request the whole tree.
+        messages::TreeDeltaFromServer treeDeltaOut;
+
+        OSVR_COMMON_EXPORT void registerTreeDeltaHandler(JsonHandler cb);
+
+        OSVR_COMMON_EXPORT void sendTreeDelta(Json::Value const &delta);
+
+        /// @brief Message from client, asking for the whole path tree because
+        /// it has none yet or has missed a delta.
+        messages::TreeRequestToServer treeRequestIn;
+
+        typedef std::function<void()> TreeRequestHandler;
+        OSVR_COMMON_EXPORT void
+        registerTreeRequestHandler(TreeRequestHandler const &cb);
+
+        OSVR_COMMON_EXPORT void sendTreeRequest();
+
       private:
         SystemComponent();
         virtual void m_parentSet();
         static int VRPN_CALLBACK
         m_handleReplaceTree(void *userdata, vrpn_HANDLERPARAM p);
+        static int VRPN_CALLBACK
+        m_handleTreeDelta(void *userdata, vrpn_HANDLERPARAM p);
+        static int VRPN_CALLBACK
+        m_handleTreeRequest(void *userdata, vrpn_HANDLERPARAM p);
 
         std::vector<JsonHandler> m_replaceTreeHandlers;
+        std::vector<JsonHandler> m_treeDeltaHandlers;
+        std::vector<TreeRequestHandler> m_treeRequestHandlers;
     };
 } // namespace common
 } // namespace osvr
@@ -141,6 +141,32 @@ namespace common {
             markConcatenation<WorkerTracePolicy>("ReleaseInterface ", path);
         }
 
+        /// @brief "Guard"-type class to trace the region of a device token
+        /// sending (or queuing) a message.
+        class DeviceSend : public TracingRegion<WorkerTracePolicy> {
+          public:
+            DeviceSend() : TracingRegion<WorkerTracePolicy>("DeviceSend") {}
+        };
+
+        /// @brief "Guard"-type class to trace the region of a client context
+        /// dispatching incoming data to its interface handlers.
+        class ClientHandlerDispatch : public TracingRegion<MainTracePolicy> {
+          public:
+            ClientHandlerDispatch()
+                : TracingRegion<MainTracePolicy>("ClientHandlerDispatch") {}
+        };
+
+        /// @brief "Guard"-type class to trace a stage of the video-based
+        /// tracker pipeline, which runs on a device (worker) thread.
+        ///
+        /// @param text Must be a string literal (its lifetime must exceed
+        /// that of the guard object).
+        class VideoTrackerStage : public TracingRegion<WorkerTracePolicy> {
+          public:
+            explicit VideoTrackerStage(const char text[])
+                : TracingRegion<WorkerTracePolicy>(text) {}
+        };
+
     } // namespace tracing
 } // namespace common
 } // namespace osvr
@@ -31,8 +31,10 @@
 #include <osvr/Connection/ConnectionDevicePtr.h>
 #include <osvr/Connection/ConnectionPtr.h>
 #include <osvr/Connection/DeviceInitObject.h>
+#include <osvr/Common/InProcessReportsPtr.h>
 #include <osvr/Util/DeviceCallbackTypesC.h>
 #include <osvr/PluginHost/RegistrationContext_fwd.h>
+#include <osvr/Util/UniquePtr.h>
 
 // Library/third-party includes
 #include <boost/noncopyable.hpp>
@@ -49,6 +51,7 @@ namespace osvr {
 /// @brief Messaging transport and device communication functionality
 /// @ingroup Connection
 namespace connection {
+    class ActivitySignal;
 
     /// @brief Class wrapping a messaging transport (server or internal)
     /// connection.
@@ -111,6 +114,22 @@ namespace connection {
         /// Someone needs to call this method frequently.
         OSVR_CONNECTION_EXPORT void process();
 
+        /// @brief Notify the thread running the main loop that there is work
+        /// pending (for instance, an async device waiting to send data), so
+        /// that it can stop waiting in waitForActivity()
+        ///
+        /// Safe to call from any thread.
+        OSVR_CONNECTION_EXPORT void signalActivity();
+
+        /// @brief Block the main loop thread until signalActivity() is
+        /// called or the given time elapses, consuming any pending signal.
+        ///
+        /// Activity signalled while no one was waiting makes this return
+        /// immediately.
+        ///
+        /// @returns true if woken by activity, false if the timeout elapsed.
+        OSVR_CONNECTION_EXPORT bool waitForActivity(int microseconds);
+
         /// @brief Register a function to be called when a client connects or
         /// pings.
         OSVR_CONNECTION_EXPORT void
@@ -124,6 +143,11 @@ namespace connection {
         /// handlers.
         OSVR_CONNECTION_EXPORT void triggerDescriptorHandlers();
 
+        /// @brief Get the hub through which devices on this connection hand
+        /// their reports directly to analysis plugins in the same process.
+        OSVR_CONNECTION_EXPORT common::InProcessReportsPtr
+        getInProcessReports() const;
+
         /// @brief Destructor
         OSVR_CONNECTION_EXPORT virtual ~Connection();
 
@@ -201,6 +225,8 @@ namespace connection {
 
       private:
         DeviceList m_devices;
+        unique_ptr<ActivitySignal> m_activity;
+        common::InProcessReportsPtr m_inProcessReports;
         std::vector<std::function<void()> > m_descriptorHandlers;
     };
 } // namespace connection
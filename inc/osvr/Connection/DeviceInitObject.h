@@ -46,6 +46,7 @@
 #include <string>
 #include <type_traits>
 #include <memory>
+#include <cstddef>
 
 namespace osvr {
 namespace connection {
@@ -86,6 +87,17 @@ struct OSVR_DeviceInitObject : boost::noncopyable {
     OSVR_CONNECTION_EXPORT void
     setTracker(osvr::connection::TrackerServerInterface **iface);
 
+    /// @brief For async devices: hand data off to the server thread through
+    /// a lock-free queue of the given capacity instead of waiting for
+    /// clear-to-send. 0 (the default) disables the queue.
+    OSVR_CONNECTION_EXPORT void setSendQueueCapacity(std::size_t capacity);
+
+    /// @brief For async devices: coalesce the data sent during each update
+    /// into a single queued batch, flushed when the update returns or once
+    /// the batch is this many microseconds old. Implies a send queue, of a
+    /// default capacity if none was set. 0 (the default) disables batching.
+    OSVR_CONNECTION_EXPORT void setSendBatchMaxLatency(uint32_t microseconds);
+
     /// @brief Add a server interface pointer to our list, which will get
     /// registered when the device is created.
     OSVR_CONNECTION_EXPORT void
@@ -148,6 +160,11 @@ struct OSVR_DeviceInitObject : boost::noncopyable {
     boost::optional<OSVR_ChannelCount> getAnalogs() const { return m_analogs; }
     boost::optional<OSVR_ChannelCount> getButtons() const { return m_buttons; }
     bool getTracker() const { return m_tracker; }
+    /// @brief Gets the send queue capacity in effect: as set, or a default
+    /// if only batching was requested. Non-zero exactly when an async device
+    /// will hand off its data through a queue.
+    OSVR_CONNECTION_EXPORT std::size_t getSendQueueCapacity() const;
+    uint32_t getSendBatchMaxLatency() const { return m_sendBatchMaxLatency; }
     osvr::connection::ServerInterfaceList const &getServerInterfaces() const {
         return m_serverInterfaces;
     }
@@ -167,6 +184,8 @@ struct OSVR_DeviceInitObject : boost::noncopyable {
     osvr::connection::ButtonServerInterface **m_buttonIface;
     bool m_tracker;
     osvr::connection::TrackerServerInterface **m_trackerIface;
+    std::size_t m_sendQueueCapacity = 0;
+    uint32_t m_sendBatchMaxLatency = 0;
     osvr::connection::ServerInterfaceList m_serverInterfaces;
     osvr::common::DeviceComponentList m_components;
     std::vector<OSVR_DeviceTokenObject **> m_tokenInterest;
@@ -49,6 +49,12 @@ namespace connection {
                                                  "with a device token!");
             return m_token->getSendGuard();
         }
+        bool isSendQueued() const {
+            BOOST_ASSERT_MSG(m_token != nullptr, "Can't check send mode "
+                                                 "before we've been supplied "
+                                                 "with a device token!");
+            return m_token->isSendQueued();
+        }
 
       private:
         DeviceToken *m_token = nullptr;
@@ -114,6 +114,10 @@ struct OSVR_DeviceTokenObject : boost::noncopyable {
 
     OSVR_CONNECTION_EXPORT osvr::util::GuardPtr getSendGuard();
 
+    /// @brief Does sendData() hand data off through a queue, such that it
+    /// never blocks and needs no send guard?
+    OSVR_CONNECTION_EXPORT bool isSendQueued() const;
+
     /// @brief Interact with connection. Only legal to end up in
     /// ConnectionDevice::sendData from within here somehow.
     void connectionInteract();
@@ -147,6 +151,7 @@ struct OSVR_DeviceTokenObject : boost::noncopyable {
                             osvr::connection::MessageType *type,
                             const char *bytestream, size_t len) = 0;
     virtual osvr::util::GuardPtr m_getSendGuard() = 0;
+    virtual bool m_isSendQueued() const;
     virtual void m_connectionInteract() = 0;
     virtual void m_stopThreads();
 
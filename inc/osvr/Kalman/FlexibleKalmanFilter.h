@@ -136,6 +136,61 @@ namespace kalman {
         state.postCorrect();
     }
 
+    /// Corrects the state with a measurement whose covariance is diagonal
+    /// (off-diagonal entries are ignored), one scalar component at a time.
+    ///
+    /// Gives the same result as correct() for such measurements, with the
+    /// same linearization, but needs no matrix decomposition: each component
+    /// is a rank-one update of the error covariance, made only on its lower
+    /// triangle through a selfadjointView so the result stays exactly
+    /// symmetric. Worthwhile for small measurements (like image points) of
+    /// large states, applied many times per frame.
+    template <typename StateType, typename ProcessModelType,
+              typename MeasurementType>
+    inline void correctSequential(StateType &state,
+                                  ProcessModelType & /*processModel*/,
+                                  MeasurementType &meas) {
+        /// Dimension of measurement
+        static const auto m = types::Dimension<MeasurementType>::value;
+        /// Dimension of state
+        static const auto n = types::Dimension<StateType>::value;
+
+        types::Matrix<m, n> H = meas.getJacobian(state);
+        types::SquareMatrix<m> R = meas.getCovariance(state);
+        types::Vector<m> deltaz = meas.getResidual(state);
+        OSVR_KALMAN_DEBUG_OUTPUT("deltaz", deltaz.transpose());
+
+        types::SquareMatrix<n> P = state.errorCovariance();
+        types::Vector<n> stateCorrection = types::Vector<n>::Zero();
+        for (types::DimensionType i = 0; i < m; ++i) {
+            types::Vector<n> PHt = P.template selfadjointView<Eigen::Lower>() *
+                                   H.row(i).transpose();
+            // Scalar innovation covariance
+            types::Scalar S = H.row(i).dot(PHt) + R(i, i);
+            // The residual is relative to the state before any correction, so
+            // account for what the earlier components already changed.
+            types::Scalar innovation =
+                deltaz[i] - H.row(i).dot(stateCorrection);
+            stateCorrection += PHt * (innovation / S);
+            P.template selfadjointView<Eigen::Lower>().rankUpdate(PHt,
+                                                                  -1. / S);
+        }
+        OSVR_KALMAN_DEBUG_OUTPUT("state correction",
+                                 stateCorrection.transpose());
+
+        // Correct the state estimate
+        state.setStateVector(state.stateVector() + stateCorrection);
+
+        // Correct the error covariance
+        types::SquareMatrix<n> newP =
+            P.template selfadjointView<Eigen::Lower>();
+        state.setErrorCovariance(newP);
+
+        // Let the state do any cleanup it has to (like fixing externalized
+        // quaternions)
+        state.postCorrect();
+    }
+
     /// The main class implementing the common components of the Kalman family
     /// of filters. Holds an instance of the state as well as an instance of the
     /// process model.
@@ -178,6 +233,12 @@ namespace kalman {
             kalman::correct(state(), processModel(), meas);
         }
 
+        /// @sa kalman::correctSequential()
+        template <typename MeasurementType>
+        void correctSequential(MeasurementType &meas) {
+            kalman::correctSequential(state(), processModel(), meas);
+        }
+
         ProcessModel &processModel() { return m_processModel; }
         ProcessModel const &processModel() const { return m_processModel; }
 
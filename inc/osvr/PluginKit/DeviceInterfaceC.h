@@ -245,6 +245,54 @@ osvrDeviceAsyncInitWithOptions(OSVR_IN_PTR OSVR_PluginRegContext ctx,
                                OSVR_OUT_PTR OSVR_DeviceToken *device)
     OSVR_FUNC_NONNULL((1, 2, 3, 4));
 
+/** @brief Configure an asynchronous device to hand its data to the server
+    through a bounded lock-free queue, instead of blocking the device thread
+    until the server's main loop grants it permission to send.
+
+    Data sent with osvrDeviceSendData(), osvrDeviceSendTimestampedData() and
+   the tracker interface is queued and sent in batches on the server thread,
+   so sending never waits for the server loop. If the queue is full, the newest
+   message is dropped (and counted) rather than blocking. Other interfaces
+   continue to wait for permission to send as usual. Tracker reports from a
+   queued device reach analysis plugins only through the connection, not in
+   process, so devices those plugins depend on should not be queued.
+
+    Call before osvrDeviceAsyncInitWithOptions(). Has no effect on synchronous
+   devices.
+
+    @param options The DeviceInitOptions for your device.
+    @param capacity Maximum number of messages waiting at once: should cover
+   the number of reports your device produces in a few server loop
+   iterations. 0 disables the queue (the default).
+*/
+OSVR_PLUGINKIT_EXPORT OSVR_ReturnCode osvrDeviceAsyncSetSendQueueCapacity(
+    OSVR_INOUT_PTR OSVR_DeviceInitOptions options, OSVR_IN size_t capacity)
+    OSVR_FUNC_NONNULL((1));
+
+/** @brief Configure an asynchronous device to coalesce all the data it sends
+    during one call of its update callback into a single batch, handed to the
+    server through the send queue (see osvrDeviceAsyncSetSendQueueCapacity())
+    when the update callback returns, and sent on the server's next loop
+    iteration.
+
+    Useful for devices that send many small reports per update (for instance,
+    one per sensor): the server thread is woken once per update rather than
+    once per report. Data sent outside the update callback is not held back.
+
+    Call before osvrDeviceAsyncInitWithOptions(). Has no effect on synchronous
+   devices. Batching makes the device queued, with the same trade-offs: if no
+   send queue capacity was set, a default capacity (counted in batches) is
+   used.
+
+    @param options The DeviceInitOptions for your device.
+    @param maxLatencyMicroseconds If an update callback runs long, a batch is
+   flushed early once it has been open this long (checked when data is sent).
+   0 disables batching (the default).
+*/
+OSVR_PLUGINKIT_EXPORT OSVR_ReturnCode osvrDeviceAsyncSetSendBatching(
+    OSVR_INOUT_PTR OSVR_DeviceInitOptions options,
+    OSVR_IN uint32_t maxLatencyMicroseconds) OSVR_FUNC_NONNULL((1));
+
 /** @} */
 
 /** @brief Request a thread sleep for at least the given number of microseconds.
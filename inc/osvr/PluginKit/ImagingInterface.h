@@ -121,17 +121,8 @@ namespace pluginkit {
                     "Must initialize the imaging interface before using it!");
             }
             cv::Mat const &frame(message.getFrame());
-            util::NumberTypeData typedata =
-                util::opencvNumberTypeData(frame.type());
-            OSVR_ImagingMetadata metadata;
-            metadata.channels = frame.channels();
-            metadata.depth = typedata.getSize();
-            metadata.width = frame.cols;
-            metadata.height = frame.rows;
-            metadata.type = typedata.isFloatingPoint()
-                                ? OSVR_IVT_FLOATING_POINT
-                                : (typedata.isSigned() ? OSVR_IVT_SIGNED_INT
-                                                       : OSVR_IVT_UNSIGNED_INT);
+            OSVR_ImagingMetadata metadata =
+                m_getMetadata(frame.rows, frame.cols, frame.type());
 
             OSVR_ReturnCode ret = osvrDeviceImagingReportFrame(
                 dev, m_iface, metadata, message.getBuf(), message.getSensor(),
@@ -141,7 +132,56 @@ namespace pluginkit {
             }
         }
 
+        /// @brief Gets a cv::Mat of the given size and OpenCV type that
+        /// refers directly to the memory the frame will be sent from (usually
+        /// shared memory), so that capture code can write into it without an
+        /// additional copy. Follow with commitFrame() for the same sensor;
+        /// the returned matrix must not be used after that.
+        cv::Mat acquireFrame(DeviceToken &dev, int rows, int cols, int type,
+                             OSVR_ChannelCount sensor = 0) {
+            if (!m_iface) {
+                throw std::logic_error(
+                    "Must initialize the imaging interface before using it!");
+            }
+            OSVR_ImageBufferElement *buf = NULL;
+            OSVR_ReturnCode ret = osvrDeviceImagingAcquireBuffer(
+                dev, m_iface, m_getMetadata(rows, cols, type), sensor, &buf);
+            if (OSVR_RETURN_SUCCESS != ret) {
+                throw std::runtime_error("Could not acquire imaging buffer!");
+            }
+            return cv::Mat(rows, cols, type, buf);
+        }
+
+        /// @brief Sends the frame written into the matrix returned by the
+        /// most recent acquireFrame() call for this sensor.
+        void commitFrame(DeviceToken &dev, OSVR_TimeValue const &timestamp,
+                         OSVR_ChannelCount sensor = 0) {
+            if (!m_iface) {
+                throw std::logic_error(
+                    "Must initialize the imaging interface before using it!");
+            }
+            OSVR_ReturnCode ret =
+                osvrDeviceImagingCommitBuffer(dev, m_iface, sensor, &timestamp);
+            if (OSVR_RETURN_SUCCESS != ret) {
+                throw std::runtime_error("Could not send imaging message!");
+            }
+        }
+
       private:
+        static OSVR_ImagingMetadata m_getMetadata(int rows, int cols,
+                                                  int type) {
+            util::NumberTypeData typedata = util::opencvNumberTypeData(type);
+            OSVR_ImagingMetadata metadata;
+            metadata.channels = CV_MAT_CN(type);
+            metadata.depth = typedata.getSize();
+            metadata.width = cols;
+            metadata.height = rows;
+            metadata.type = typedata.isFloatingPoint()
+                                ? OSVR_IVT_FLOATING_POINT
+                                : (typedata.isSigned() ? OSVR_IVT_SIGNED_INT
+                                                       : OSVR_IVT_UNSIGNED_INT);
+            return metadata;
+        }
         OSVR_ImagingDeviceInterface m_iface;
     };
     /// @}
@@ -96,6 +96,52 @@ osvrDeviceImagingReportFrame(OSVR_IN_PTR OSVR_DeviceToken dev,
                              OSVR_IN OSVR_ChannelCount sensor,
                              OSVR_IN_PTR OSVR_TimeValue const *timestamp)
     OSVR_FUNC_NONNULL((1, 2, 4, 6));
+
+/** @brief Borrow a writable buffer for a frame for a sensor, so the image can
+    be written directly into its final location (usually a shared-memory ring
+    buffer entry) instead of being copied there by
+    osvrDeviceImagingReportFrame().
+
+    The buffer remains valid until the matching
+    osvrDeviceImagingCommitBuffer() call, or until this function is called again
+    for the same sensor, which discards the previous uncommitted buffer. Must be
+    called from the same thread that commits the buffer. Does not wait for
+    clearance to send, so it may be called while the frame is being captured.
+
+    @param dev Device token
+    @param iface Imaging interface
+    @param metadata Image metadata describing the frame to be written: the
+   buffer will be `height * width * channels * depth` bytes.
+    @param sensor Sensor number, usually 0
+    @param [out] buffer Receives a pointer to the writable buffer.
+*/
+OSVR_PLUGINKIT_EXPORT
+OSVR_ReturnCode osvrDeviceImagingAcquireBuffer(
+    OSVR_IN_PTR OSVR_DeviceToken dev,
+    OSVR_IN_PTR OSVR_ImagingDeviceInterface iface,
+    OSVR_IN OSVR_ImagingMetadata metadata, OSVR_IN OSVR_ChannelCount sensor,
+    OSVR_OUT_PTR OSVR_ImageBufferElement **buffer)
+    OSVR_FUNC_NONNULL((1, 2, 5));
+
+/** @brief Report the frame written into the buffer most recently obtained from
+    osvrDeviceImagingAcquireBuffer() for this sensor. The buffer must not be
+    accessed after this call.
+
+    @param dev Device token
+    @param iface Imaging interface
+    @param sensor Sensor number, usually 0
+    @param timestamp Timestamp correlating to frame.
+
+    @return OSVR_RETURN_FAILURE if there was no acquired buffer for the sensor,
+    or if the frame could not be sent (in which case the buffer is discarded).
+*/
+OSVR_PLUGINKIT_EXPORT
+OSVR_ReturnCode
+osvrDeviceImagingCommitBuffer(OSVR_IN_PTR OSVR_DeviceToken dev,
+                              OSVR_IN_PTR OSVR_ImagingDeviceInterface iface,
+                              OSVR_IN OSVR_ChannelCount sensor,
+                              OSVR_IN_PTR OSVR_TimeValue const *timestamp)
+    OSVR_FUNC_NONNULL((1, 2, 4));
 /** @} */ /* end of group */
 
 OSVR_EXTERN_C_END
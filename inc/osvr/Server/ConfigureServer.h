@@ -80,6 +80,13 @@ namespace server {
         ///
         /// `port` defaults to the assigned VRPN port (3883)
         ///
+        /// `sleep` is the time in milliseconds the main loop sleeps between
+        /// iterations. If `eventDriven` is true, that sleep instead ends early
+        /// whenever a device has data to send.
+        ///
+        /// If `pathTreeDeltas` is true, path tree changes are sent to clients
+        /// as deltas instead of full trees.
+        ///
         /// @throws std::out_of_range if an invalid port (<1) is specified.
         OSVR_SERVER_EXPORT ServerPtr constructServer();
 
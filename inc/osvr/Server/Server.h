@@ -224,6 +224,24 @@ namespace server {
         /// Call only before starting the server or from within server thread.
         OSVR_SERVER_EXPORT void setSleepTime(int microseconds);
 
+        /// @brief Sets whether the server loop should wake up early from its
+        /// sleep when there is work pending (an async device with data to
+        /// send, or a call from another thread), rather than always sleeping
+        /// for the full sleep time. The sleep time becomes an upper bound on
+        /// how long the loop waits without such activity.
+        ///
+        /// Call only before starting the server or from within server thread.
+        OSVR_SERVER_EXPORT void setEventDriven(bool eventDriven);
+
+        /// @brief Sets whether path tree changes should be sent to clients as
+        /// versioned deltas rather than as full replacement trees. Clients
+        /// ask for a full tree when they first connect or miss a delta, and
+        /// clients already up to date ignore it. Requires clients new enough
+        /// to understand tree delta messages.
+        ///
+        /// Call only before starting the server or from within server thread.
+        OSVR_SERVER_EXPORT void setPathTreeDeltas(bool deltas);
+
 #if 0
         /// @brief Returns the amount of time (in microseconds) that the server
         /// loop sleeps each loop.
@@ -0,0 +1,96 @@
+/** @file
+    @brief Header providing extrapolation of a pose by a velocity state.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_PoseExtrapolation_h_GUID_CF16201C_D3FA_4583_85AB_5D42CF13C524
+#define INCLUDED_PoseExtrapolation_h_GUID_CF16201C_D3FA_4583_85AB_5D42CF13C524
+
+// Internal Includes
+#include <osvr/Util/ClientReportTypesC.h>
+#include <osvr/Util/EigenInterop.h>
+
+// Library/third-party includes
+#include <osvr/Util/EigenCoreGeometry.h>
+
+// Standard includes
+#include <cmath>
+
+namespace osvr {
+namespace util {
+    /// @brief Converts an incremental rotation (as in an angular velocity
+    /// state) to a rotation vector per second: the axis, scaled by the rate
+    /// of rotation about it in radians per second.
+    inline Eigen::Vector3d
+    angularVelocityFromIncrementalRotation(OSVR_IncrementalQuaternion const &inc) {
+        if (!(inc.dt > 0)) {
+            return Eigen::Vector3d::Zero();
+        }
+        Eigen::Quaterniond q =
+            eigen_interop::map(inc.incrementalRotation);
+        if (q.w() < 0) {
+            // Same rotation, but the short way around.
+            q.coeffs() *= -1;
+        }
+        double sinHalfAngle = q.vec().norm();
+        if (!(sinHalfAngle > 0)) {
+            return Eigen::Vector3d::Zero();
+        }
+        // atan2 rather than acos, to keep precision for the small rotations
+        // typical of one tracker report.
+        double angle = 2. * std::atan2(sinHalfAngle, q.w());
+        return q.vec() * (angle / (sinHalfAngle * inc.dt));
+    }
+
+    /// @brief Extrapolates a pose @p dt seconds forward (or backward, if
+    /// negative) with constant velocity, using whichever parts of @p vel are
+    /// flagged valid.
+    ///
+    /// Like the tracker velocity reports themselves, the angular velocity is
+    /// taken to be in the room frame, so its incremental rotation is applied
+    /// on the left.
+    inline void extrapolatePose(OSVR_PoseState &pose,
+                                OSVR_VelocityState const &vel, double dt) {
+        auto mappedPose = eigen_interop::map(pose);
+        if (vel.linearVelocityValid) {
+            mappedPose.translation() +=
+                eigen_interop::map(vel.linearVelocity) * dt;
+        }
+        if (vel.angularVelocityValid) {
+            Eigen::Vector3d rotation =
+                angularVelocityFromIncrementalRotation(vel.angularVelocity) *
+                dt;
+            double angle = rotation.norm();
+            if (angle > 0) {
+                Eigen::Quaterniond orientation = mappedPose.rotation();
+                mappedPose.rotation() =
+                    (Eigen::Quaterniond(
+                         Eigen::AngleAxisd(angle, rotation / angle)) *
+                     orientation)
+                        .normalized();
+            }
+        }
+    }
+} // namespace util
+} // namespace osvr
+
+#endif // INCLUDED_PoseExtrapolation_h_GUID_CF16201C_D3FA_4583_85AB_5D42CF13C524
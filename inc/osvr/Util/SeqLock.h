@@ -0,0 +1,123 @@
+/** @file
+    @brief Header providing a single-writer, multiple-reader sequence lock
+    ("seqlock") around a small trivially-copyable value.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_SeqLock_h_GUID_1D9F9ED1_6AC1_4C4E_83FA_602B15212619
+#define INCLUDED_SeqLock_h_GUID_1D9F9ED1_6AC1_4C4E_83FA_602B15212619
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <boost/type_traits/has_trivial_copy.hpp>
+
+// Standard includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace osvr {
+namespace util {
+    /// @brief Holds the latest value of a small, trivially-copyable type,
+    /// written by a single thread and readable by any number of threads
+    /// without locks.
+    ///
+    /// The writer never waits. Readers copy the value out and retry if a write
+    /// overlapped the copy. The value is stored as machine-word atomics, so
+    /// that concurrent access is well-defined.
+    template <typename T> class SeqLock {
+      public:
+        static_assert(boost::has_trivial_copy<T>::value,
+                      "SeqLock requires a trivially-copyable type.");
+
+        SeqLock() : m_seq(0), m_hasValue(false) {
+            for (auto &word : m_words) {
+                word.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        SeqLock(SeqLock const &) = delete;
+        SeqLock &operator=(SeqLock const &) = delete;
+
+        /// @brief Stores a new value. Only ever call from a single (writer)
+        /// thread at a time.
+        void store(T const &value) {
+            Word buf[WORDS] = {};
+            std::memcpy(buf, &value, sizeof(T));
+            auto seq = m_seq.load(std::memory_order_relaxed);
+            m_seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (std::size_t i = 0; i < WORDS; ++i) {
+                m_words[i].store(buf[i], std::memory_order_relaxed);
+            }
+            m_seq.store(seq + 2, std::memory_order_release);
+            m_hasValue.store(true, std::memory_order_release);
+        }
+
+        /// @brief Copies out the latest value, from any thread.
+        /// @return false (leaving @p value untouched) if nothing has been
+        /// stored yet.
+        bool load(T &value) const {
+            if (!hasValue()) {
+                return false;
+            }
+            Word buf[WORDS];
+            for (;;) {
+                auto seq = m_seq.load(std::memory_order_acquire);
+                if (seq % 2 != 0) {
+                    // Write in progress: let the writer finish.
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (std::size_t i = 0; i < WORDS; ++i) {
+                    buf[i] = m_words[i].load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (m_seq.load(std::memory_order_relaxed) == seq) {
+                    break;
+                }
+            }
+            std::memcpy(&value, buf, sizeof(T));
+            return true;
+        }
+
+        /// @brief Whether a value has ever been stored.
+        bool hasValue() const {
+            return m_hasValue.load(std::memory_order_acquire);
+        }
+
+      private:
+        typedef std::uintptr_t Word;
+        static const std::size_t WORDS =
+            (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+        std::atomic<std::size_t> m_seq;
+        std::atomic<bool> m_hasValue;
+        std::atomic<Word> m_words[WORDS];
+    };
+} // namespace util
+} // namespace osvr
+
+#endif // INCLUDED_SeqLock_h_GUID_1D9F9ED1_6AC1_4C4E_83FA_602B15212619
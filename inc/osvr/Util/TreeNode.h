@@ -38,6 +38,8 @@
 #include <vector>
 #include <algorithm>
 #include <stdexcept>
+#include <unordered_map>
+#include <functional>
 
 namespace osvr {
 namespace util {
@@ -49,6 +51,22 @@ namespace util {
             NoSuchChild(std::string const &name)
                 : std::runtime_error("No child found with the name " + name) {}
         };
+        namespace detail {
+            /// @brief Hash functor for the child index, whose keys point to
+            /// the (immutable) names stored in the child nodes themselves.
+            struct NamePtrHash {
+                std::size_t operator()(std::string const *name) const {
+                    return std::hash<std::string>()(*name);
+                }
+            };
+            /// @brief Equality functor for the child index.
+            struct NamePtrEqual {
+                bool operator()(std::string const *a,
+                                std::string const *b) const {
+                    return *a == *b;
+                }
+            };
+        } // namespace detail
         /// @brief A node in a generic tree, which can contain an object by
         /// value.
         /// @tparam ValueType The contained value type: must be
@@ -67,7 +85,9 @@ namespace util {
         /// child of the given name (default-constructing one if it doesn't
         /// exist)
         ///
-        /// @todo methods to remove a child (by pointer and by name)
+        /// Lookup of children by name is a linear search for nodes with few
+        /// children, and uses a hash index once a node has more than
+        /// INDEX_THRESHOLD children.
         template <typename ValueType>
         class TreeNode : boost::noncopyable,
                          boost::operators<TreeNode<ValueType> > {
@@ -110,6 +130,13 @@ namespace util {
             /// exist.
             type const &getChildByName(std::string const &name) const;
 
+            /// @brief Remove the named child, and with it all its
+            /// descendants, if it exists. Any references to them are
+            /// invalidated.
+            ///
+            /// @return true if there was such a child to remove.
+            bool removeChildByName(std::string const &name);
+
             /// @brief Gets the name of the current node. This will be empty if
             /// and
             /// only if this is the root.
@@ -197,6 +224,17 @@ namespace util {
             /// @brief Ownership of children
             ChildList m_children;
 
+            /// @brief Number of children above which m_childIndex is used.
+            static const std::size_t INDEX_THRESHOLD = 8;
+
+            typedef std::unordered_map<std::string const *, weak_ptr_type,
+                                       detail::NamePtrHash,
+                                       detail::NamePtrEqual> ChildIndex;
+            /// @brief Children by name, keyed by pointers to the names held
+            /// by the children themselves. Empty until the node has more than
+            /// INDEX_THRESHOLD children.
+            ChildIndex m_childIndex;
+
             /// @brief Name
             std::string const m_name;
 
@@ -267,6 +305,22 @@ namespace util {
             throw NoSuchChild(name);
         }
 
+        template <typename ValueType>
+        inline bool
+        TreeNode<ValueType>::removeChildByName(std::string const &name) {
+            auto it = std::find_if(
+                begin(m_children), end(m_children),
+                [&](ptr_type const &n) { return n->getName() == name; });
+            if (it == end(m_children)) {
+                return false;
+            }
+            // The index is keyed by the child's own name, so it must go
+            // before the child does.
+            m_childIndex.erase(&(*it)->getName());
+            m_children.erase(it);
+            return true;
+        }
+
         template <typename ValueType>
         inline std::string const &TreeNode<ValueType>::getName() const {
             return m_name;
@@ -302,8 +356,11 @@ namespace util {
         template <typename ValueType>
         inline typename TreeNode<ValueType>::weak_ptr_type
         TreeNode<ValueType>::m_getChildByName(std::string const &name) const {
-            /// @todo Don't use a linear search here - use an unordered map or
-            /// something.
+            if (!m_childIndex.empty()) {
+                auto indexIt = m_childIndex.find(&name);
+                return indexIt == end(m_childIndex) ? nullptr
+                                                    : indexIt->second;
+            }
             auto it = std::find_if(
                 begin(m_children), end(m_children),
                 [&](ptr_type const &n) { return n->getName() == name; });
@@ -318,6 +375,14 @@ namespace util {
         inline void TreeNode<ValueType>::m_addChild(
             typename TreeNode<ValueType>::ptr_type const &child) {
             m_children.push_back(child);
+            if (!m_childIndex.empty()) {
+                m_childIndex.emplace(&child->getName(), child.get());
+            } else if (m_children.size() > INDEX_THRESHOLD) {
+                m_childIndex.reserve(m_children.size() * 2);
+                for (auto const &node : m_children) {
+                    m_childIndex.emplace(&node->getName(), node.get());
+                }
+            }
         }
 
         template <typename ValueType>
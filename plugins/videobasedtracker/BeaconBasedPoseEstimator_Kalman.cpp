@@ -241,10 +241,11 @@ namespace vbtracker {
             debug.variance = effectiveVariance;
             meas.setVariance(effectiveVariance);
 
-            /// Now, do the correction.
+            /// Now, do the correction: the measurement covariance is diagonal,
+            /// so the two image axes can be applied as cheap scalar updates.
             auto model =
                 kalman::makeAugmentedProcessModel(m_model, beaconProcess);
-            kalman::correct(state, model, meas);
+            kalman::correctSequential(state, model, meas);
             m_gotMeasurement = true;
         }
 
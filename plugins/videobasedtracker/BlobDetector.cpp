@@ -0,0 +1,263 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "BlobDetector.h"
+
+// Library/third-party includes
+#include <opencv2/core/version.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+
+namespace osvr {
+namespace vbtracker {
+
+    void BlobDetector::detect(cv::Mat const &grayImage,
+                              cv::SimpleBlobDetector::Params const &params,
+                              std::vector<cv::KeyPoint> &keypoints) {
+        keypoints.clear();
+        for (std::size_t i = 0; i < m_numGroups; ++i) {
+            m_groups[i].clear();
+        }
+        m_numGroups = 0;
+        if (grayImage.empty()) {
+            return;
+        }
+
+        m_imageBounds = cv::Rect(0, 0, grayImage.cols, grayImage.rows);
+        // No-op unless the image size changed.
+        m_binarized.create(grayImage.size(), CV_8UC1);
+
+        m_regions.clear();
+        m_regions.push_back(m_imageBounds);
+        for (double thresh = params.minThreshold; thresh < params.maxThreshold;
+             thresh += params.thresholdStep) {
+            m_levelCenters.clear();
+            m_nextRegions.clear();
+            for (auto const &region : m_regions) {
+                m_findBlobs(grayImage, region, thresh, params);
+            }
+            m_groupLevelCenters(params);
+            if (m_nextRegions.empty() || !(params.thresholdStep > 0)) {
+                // No contours at this threshold means none at any higher one.
+                break;
+            }
+            m_regions.swap(m_nextRegions);
+        }
+
+        for (std::size_t i = 0; i < m_numGroups; ++i) {
+            auto const &group = m_groups[i];
+            if (group.size() < params.minRepeatability) {
+                continue;
+            }
+            cv::Point2d sumPoint(0, 0);
+            double normalizer = 0;
+            for (auto const &center : group) {
+                sumPoint += center.confidence * center.location;
+                normalizer += center.confidence;
+            }
+            sumPoint *= (1. / normalizer);
+            auto radius = static_cast<float>(group[group.size() / 2].radius);
+/// Match the keypoint size reported by cv::SimpleBlobDetector, which changed
+/// from radius to diameter in OpenCV 3.
+#if CV_MAJOR_VERSION == 2
+            keypoints.push_back(cv::KeyPoint(sumPoint, radius));
+#else
+            keypoints.push_back(cv::KeyPoint(sumPoint, radius * 2.f));
+#endif
+        }
+    }
+
+    void
+    BlobDetector::m_findBlobs(cv::Mat const &grayImage, cv::Rect const &region,
+                              double threshold,
+                              cv::SimpleBlobDetector::Params const &params) {
+        cv::Mat binarized = m_binarized(region);
+        cv::threshold(grayImage(region), binarized, threshold, 255,
+                      CV_THRESH_BINARY);
+        // The binarized image is scratch, so we can let this modify it.
+        // m_contours keeps the storage of the contours it still has room
+        // for, but this allocates regardless (see the class docs).
+        cv::findContours(binarized, m_contours, CV_RETR_LIST,
+                         CV_CHAIN_APPROX_NONE, region.tl());
+        for (auto const &contour : m_contours) {
+            m_addNextRegion(cv::boundingRect(contour));
+            Center center;
+            if (m_evaluateContour(grayImage, contour, threshold, params,
+                                  center)) {
+                m_levelCenters.push_back(center);
+            }
+        }
+    }
+
+    bool BlobDetector::m_evaluateContour(
+        cv::Mat const &grayImage, Contour const &contour, double threshold,
+        cv::SimpleBlobDetector::Params const &params, Center &center) {
+        center.confidence = 1;
+        cv::Moments moms = cv::moments(contour);
+        if (params.filterByArea) {
+            double area = moms.m00;
+            if (area < params.minArea || area >= params.maxArea) {
+                return false;
+            }
+        }
+
+        if (params.filterByCircularity) {
+            double area = moms.m00;
+            double perimeter = cv::arcLength(contour, true);
+            double ratio = 4 * CV_PI * area / (perimeter * perimeter);
+            if (ratio < params.minCircularity ||
+                ratio >= params.maxCircularity) {
+                return false;
+            }
+        }
+
+        if (params.filterByInertia) {
+            double denominator =
+                std::sqrt(std::pow(2 * moms.mu11, 2) +
+                          std::pow(moms.mu20 - moms.mu02, 2));
+            const double eps = 1e-2;
+            double ratio = 1;
+            if (denominator > eps) {
+                double cosmin = (moms.mu20 - moms.mu02) / denominator;
+                double sinmin = 2 * moms.mu11 / denominator;
+                double cosmax = -cosmin;
+                double sinmax = -sinmin;
+
+                double imin = 0.5 * (moms.mu20 + moms.mu02) -
+                              0.5 * (moms.mu20 - moms.mu02) * cosmin -
+                              moms.mu11 * sinmin;
+                double imax = 0.5 * (moms.mu20 + moms.mu02) -
+                              0.5 * (moms.mu20 - moms.mu02) * cosmax -
+                              moms.mu11 * sinmax;
+                ratio = imin / imax;
+            }
+            if (ratio < params.minInertiaRatio ||
+                ratio >= params.maxInertiaRatio) {
+                return false;
+            }
+            center.confidence = ratio * ratio;
+        }
+
+        if (params.filterByConvexity) {
+            cv::convexHull(contour, m_hull);
+            double area = cv::contourArea(contour);
+            double hullArea = cv::contourArea(m_hull);
+            double ratio = area / hullArea;
+            if (ratio < params.minConvexity || ratio >= params.maxConvexity) {
+                return false;
+            }
+        }
+
+        if (moms.m00 == 0.0) {
+            return false;
+        }
+        center.location = cv::Point2d(moms.m10 / moms.m00, moms.m01 / moms.m00);
+
+        if (params.filterByColor) {
+            // What the binarized image held here before finding contours.
+            auto binaryValue =
+                grayImage.at<uchar>(cvRound(center.location.y),
+                                    cvRound(center.location.x)) > threshold
+                    ? 255
+                    : 0;
+            if (binaryValue != params.blobColor) {
+                return false;
+            }
+        }
+
+        // Blob radius: median distance from the center to the contour.
+        m_dists.clear();
+        for (auto const &pt : contour) {
+            m_dists.push_back(cv::norm(center.location - cv::Point2d(pt)));
+        }
+        std::sort(begin(m_dists), end(m_dists));
+        center.radius =
+            (m_dists[(m_dists.size() - 1) / 2] + m_dists[m_dists.size() / 2]) /
+            2.;
+        return true;
+    }
+
+    void BlobDetector::m_addNextRegion(cv::Rect const &bounds) {
+        // Grow by a pixel so the region has a background border, as the
+        // contour finder expects.
+        auto region = cv::Rect(bounds.x - 1, bounds.y - 1, bounds.width + 2,
+                               bounds.height + 2) &
+                      m_imageBounds;
+        // If this overlaps any other region, a connected component could
+        // straddle them, so merge until the regions are disjoint.
+        bool merged = true;
+        while (merged) {
+            merged = false;
+            for (auto it = begin(m_nextRegions), e = end(m_nextRegions);
+                 it != e; ++it) {
+                if ((*it & region).area() > 0) {
+                    region |= *it;
+                    m_nextRegions.erase(it);
+                    merged = true;
+                    break;
+                }
+            }
+        }
+        m_nextRegions.push_back(region);
+    }
+
+    void BlobDetector::m_groupLevelCenters(
+        cv::SimpleBlobDetector::Params const &params) {
+        // Centers at this level are only compared with groups from earlier
+        // levels.
+        auto earlierGroups = m_numGroups;
+        for (auto const &center : m_levelCenters) {
+            bool isNew = true;
+            for (std::size_t j = 0; j < earlierGroups; ++j) {
+                auto &group = m_groups[j];
+                auto const &median = group[group.size() / 2];
+                double dist = cv::norm(median.location - center.location);
+                isNew = dist >= params.minDistBetweenBlobs &&
+                        dist >= median.radius && dist >= center.radius;
+                if (!isNew) {
+                    // Keep the group sorted by radius.
+                    group.push_back(center);
+                    for (auto k = group.size() - 1;
+                         k > 0 && group[k].radius < group[k - 1].radius; --k) {
+                        std::swap(group[k], group[k - 1]);
+                    }
+                    break;
+                }
+            }
+            if (isNew) {
+                if (m_groups.size() == m_numGroups) {
+                    m_groups.emplace_back();
+                }
+                m_groups[m_numGroups].push_back(center);
+                ++m_numGroups;
+            }
+        }
+    }
+
+} // namespace vbtracker
+} // namespace osvr
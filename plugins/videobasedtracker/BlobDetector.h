@@ -0,0 +1,110 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BlobDetector_h_GUID_E56F7F1B_5497_4274_BBB9_369FE737CCE2
+#define INCLUDED_BlobDetector_h_GUID_E56F7F1B_5497_4274_BBB9_369FE737CCE2
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+#include <opencv2/features2d/features2d.hpp>
+
+// Standard includes
+#include <vector>
+
+namespace osvr {
+namespace vbtracker {
+    /// @brief A long-lived equivalent of cv::SimpleBlobDetector: it runs the
+    /// same threshold-ladder algorithm with the same parameters, but keeps its
+    /// scratch buffers from frame to frame instead of allocating them anew
+    /// for every detection.
+    ///
+    /// cv::findContours still allocates on every call, which this can't
+    /// avoid: it builds the contours in its own working storage before
+    /// copying them out, and resizing m_contours to fit frees the storage of
+    /// any contours past the new count.
+    ///
+    /// Since the pixels above a threshold are a subset of those above any
+    /// lower threshold, only the first threshold level looks at the whole
+    /// image: each higher level only binarizes and searches the neighborhoods
+    /// of the contours found at the level below, and the ladder stops early
+    /// once a level finds nothing.
+    class BlobDetector {
+      public:
+        /// @brief Finds blobs in a single-channel 8-bit image, replacing the
+        /// contents of @p keypoints.
+        void detect(cv::Mat const &grayImage,
+                    cv::SimpleBlobDetector::Params const &params,
+                    std::vector<cv::KeyPoint> &keypoints);
+
+      private:
+        struct Center {
+            cv::Point2d location;
+            double radius;
+            double confidence;
+        };
+        typedef std::vector<cv::Point> Contour;
+
+        /// @brief Binarizes the image within the region, finds the contours
+        /// there, and adds those passing the filters to m_levelCenters. Also
+        /// records the regions to search at the next threshold level.
+        void m_findBlobs(cv::Mat const &grayImage, cv::Rect const &region,
+                         double threshold,
+                         cv::SimpleBlobDetector::Params const &params);
+
+        /// @brief Whether the contour passes the filters, computing its
+        /// center if so.
+        bool m_evaluateContour(cv::Mat const &grayImage, Contour const &contour,
+                               double threshold,
+                               cv::SimpleBlobDetector::Params const &params,
+                               Center &center);
+
+        /// @brief Adds a region to search at the next level: the bounding box
+        /// of a contour, grown by a pixel, merged with any overlapping ones so
+        /// that every region holds whole connected components.
+        void m_addNextRegion(cv::Rect const &bounds);
+
+        /// @brief Adds the centers found at this level to the groups of
+        /// matching centers from earlier levels, or to new groups.
+        void m_groupLevelCenters(cv::SimpleBlobDetector::Params const &params);
+
+        cv::Rect m_imageBounds;
+        cv::Mat m_binarized;
+        std::vector<Contour> m_contours;
+        Contour m_hull;
+        std::vector<double> m_dists;
+        std::vector<cv::Rect> m_regions;
+        std::vector<cv::Rect> m_nextRegions;
+        std::vector<Center> m_levelCenters;
+        /// @brief Only the first m_numGroups are in use: the rest are kept
+        /// (cleared) so their storage can be reused.
+        std::vector<std::vector<Center> > m_groups;
+        std::size_t m_numGroups = 0;
+    };
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_BlobDetector_h_GUID_E56F7F1B_5497_4274_BBB9_369FE737CCE2
@@ -0,0 +1,51 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "BlobExtractor.h"
+#include "SBDBlobExtractor.h"
+#include "BrightBlobExtractor.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace vbtracker {
+    BlobExtractor::~BlobExtractor() {}
+
+    BlobExtractorPtr makeBlobExtractor(ConfigParams const &params) {
+        switch (params.blobParams.extractor) {
+        case BlobExtractorType::BrightBlob:
+            return BlobExtractorPtr{new BrightBlobExtractor(params)};
+        case BlobExtractorType::SimpleBlobDetector:
+        default:
+            return BlobExtractorPtr{new SBDBlobExtractor(params)};
+        }
+    }
+
+} // namespace vbtracker
+} // namespace osvr
@@ -0,0 +1,74 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BlobExtractor_h_GUID_8F447B5B_EDCC_4AA9_BDB5_B83E6C156F41
+#define INCLUDED_BlobExtractor_h_GUID_8F447B5B_EDCC_4AA9_BDB5_B83E6C156F41
+
+// Internal Includes
+#include "Types.h"
+#include "LED.h"
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+
+// Standard includes
+#include <vector>
+#include <memory>
+
+namespace osvr {
+namespace vbtracker {
+    /// @brief Base class for the implementations of blob-extraction duties on
+    /// incoming frames.
+    class BlobExtractor {
+      public:
+        virtual ~BlobExtractor();
+
+        /// @brief Finds the blobs in a single-channel 8-bit image.
+        ///
+        /// @return a reference to the measurements, valid until the next call.
+        virtual std::vector<LedMeasurement> const &
+        extractBlobs(cv::Mat const &grayImage) = 0;
+
+        /// @name Debug images
+        /// @brief Only available when the debug parameter is set, since
+        /// otherwise frames aren't retained: empty images are returned.
+        /// @{
+        virtual cv::Mat const &getDebugThresholdImage() = 0;
+        virtual cv::Mat const &getDebugBlobImage() = 0;
+        virtual cv::Mat const &getDebugExtraImage() = 0;
+        /// @}
+
+      protected:
+        BlobExtractor() = default;
+    };
+
+    typedef std::unique_ptr<BlobExtractor> BlobExtractorPtr;
+
+    /// @brief Creates the blob extractor selected by the blob parameters.
+    BlobExtractorPtr makeBlobExtractor(ConfigParams const &params);
+
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_BlobExtractor_h_GUID_8F447B5B_EDCC_4AA9_BDB5_B83E6C156F41
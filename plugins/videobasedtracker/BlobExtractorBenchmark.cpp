@@ -0,0 +1,242 @@
+/** @file
+    @brief Implementation of a benchmark comparing the blob extractors, for
+    speed and for centroid accuracy.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "BlobExtractor.h"
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+
+// Standard includes
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace osvr::vbtracker;
+typedef std::chrono::steady_clock clock_type;
+
+static const int PASSES = 20;
+
+/// @brief Frames are numbered from 0001.tif, as FakeImageSource expects.
+static std::vector<cv::Mat> loadFrames(std::string const &dir) {
+    std::vector<cv::Mat> ret;
+    for (int imageNum = 1;; ++imageNum) {
+        std::ostringstream fileName;
+        fileName << dir << "/" << std::setfill('0') << std::setw(4)
+                 << imageNum << ".tif";
+        cv::Mat image = cv::imread(fileName.str(), CV_LOAD_IMAGE_GRAYSCALE);
+        if (!image.data) {
+            break;
+        }
+        ret.push_back(image);
+    }
+    return ret;
+}
+
+/// @brief Dark frames with Gaussian spots at known subpixel locations, plus a
+/// little noise.
+static std::vector<cv::Mat>
+makeSyntheticFrames(std::vector<std::vector<cv::Point2f> > &truth) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> xDist(10.f, 630.f);
+    std::uniform_real_distribution<float> yDist(10.f, 470.f);
+    std::normal_distribution<double> noise(0, 2);
+    const int FRAMES = 30;
+    const std::size_t SPOTS = 40;
+    const double SIGMA = 1.2;
+    std::vector<cv::Mat> ret;
+    truth.clear();
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        cv::Mat image(480, 640, CV_64FC1, cv::Scalar(15));
+        std::vector<cv::Point2f> spots;
+        while (spots.size() < SPOTS) {
+            cv::Point2f spot(xDist(rng), yDist(rng));
+            bool tooClose = false;
+            for (auto const &other : spots) {
+                tooClose = tooClose || cv::norm(other - spot) < 8;
+            }
+            if (tooClose) {
+                continue;
+            }
+            spots.push_back(spot);
+            // Dim spots, like the dim half of an LED's blink pattern, too.
+            auto peak = spots.size() % 2 ? 230. : 150.;
+            for (int y = int(spot.y) - 5; y <= int(spot.y) + 5; ++y) {
+                for (int x = int(spot.x) - 5; x <= int(spot.x) + 5; ++x) {
+                    auto dx = x - spot.x;
+                    auto dy = y - spot.y;
+                    image.at<double>(y, x) +=
+                        peak * std::exp(-(dx * dx + dy * dy) /
+                                        (2 * SIGMA * SIGMA));
+                }
+            }
+        }
+        for (int y = 0; y < image.rows; ++y) {
+            for (int x = 0; x < image.cols; ++x) {
+                image.at<double>(y, x) += noise(rng);
+            }
+        }
+        cv::Mat gray;
+        image.convertTo(gray, CV_8UC1);
+        ret.push_back(gray);
+        truth.push_back(spots);
+    }
+    return ret;
+}
+
+/// @brief Distance to the nearest point, or a negative number if there is
+/// none within maxDist.
+static double nearest(cv::Point2f const &pt,
+                      std::vector<cv::Point2f> const &candidates,
+                      double maxDist) {
+    double best = -1;
+    for (auto const &candidate : candidates) {
+        auto dist = cv::norm(candidate - pt);
+        if (dist < maxDist && (best < 0 || dist < best)) {
+            best = dist;
+        }
+    }
+    return best;
+}
+
+static std::vector<cv::Point2f>
+getLocations(std::vector<LedMeasurement> const &measurements) {
+    std::vector<cv::Point2f> ret;
+    for (auto const &meas : measurements) {
+        ret.push_back(meas.loc);
+    }
+    return ret;
+}
+
+struct Results {
+    double msPerFrame = 0;
+    std::vector<std::vector<cv::Point2f> > locations;
+};
+
+static Results run(BlobExtractorType type,
+                   std::vector<cv::Mat> const &frames) {
+    ConfigParams params;
+    params.blobParams.extractor = type;
+    auto extractor = makeBlobExtractor(params);
+    Results ret;
+    for (auto const &frame : frames) {
+        ret.locations.push_back(getLocations(extractor->extractBlobs(frame)));
+    }
+    auto start = clock_type::now();
+    for (int pass = 0; pass < PASSES; ++pass) {
+        for (auto const &frame : frames) {
+            extractor->extractBlobs(frame);
+        }
+    }
+    ret.msPerFrame =
+        std::chrono::duration<double, std::milli>(clock_type::now() - start)
+            .count() /
+        (PASSES * frames.size());
+    return ret;
+}
+
+/// @brief How well the @p found locations match the @p expected ones: the
+/// fraction found, and the mean distance to those found.
+static void reportMatch(std::string const &what,
+                        std::vector<std::vector<cv::Point2f> > const &expected,
+                        std::vector<std::vector<cv::Point2f> > const &found) {
+    std::size_t total = 0;
+    std::size_t matched = 0;
+    double sumDist = 0;
+    double maxDist = 0;
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        for (auto const &pt : expected[i]) {
+            ++total;
+            auto dist = nearest(pt, found[i], 3.);
+            if (dist < 0) {
+                continue;
+            }
+            ++matched;
+            sumDist += dist;
+            maxDist = std::max(maxDist, dist);
+        }
+    }
+    std::cout << "  " << what << ": matched " << matched << " of " << total;
+    if (matched) {
+        std::cout << ", mean distance " << sumDist / matched
+                  << " px, max " << maxDist << " px";
+    }
+    std::cout << std::endl;
+}
+
+static std::size_t
+countBlobs(std::vector<std::vector<cv::Point2f> > const &locations) {
+    std::size_t ret = 0;
+    for (auto const &frame : locations) {
+        ret += frame.size();
+    }
+    return ret;
+}
+
+static void compare(std::string const &name, std::vector<cv::Mat> const &frames,
+                    std::vector<std::vector<cv::Point2f> > const *truth) {
+    if (frames.empty()) {
+        std::cout << name << ": no frames loaded, skipping" << std::endl;
+        return;
+    }
+    std::cout << name << " (" << frames.size() << " frames, "
+              << frames[0].cols << "x" << frames[0].rows << ")" << std::endl;
+    auto sbd = run(BlobExtractorType::SimpleBlobDetector, frames);
+    auto bright = run(BlobExtractorType::BrightBlob, frames);
+    std::cout << "  simple: " << sbd.msPerFrame << " ms/frame, "
+              << countBlobs(sbd.locations) / frames.size()
+              << " blobs/frame" << std::endl;
+    std::cout << "  bright: " << bright.msPerFrame << " ms/frame, "
+              << countBlobs(bright.locations) / frames.size()
+              << " blobs/frame" << std::endl;
+    if (truth) {
+        reportMatch("simple vs. truth", *truth, sbd.locations);
+        reportMatch("bright vs. truth", *truth, bright.locations);
+    } else {
+        reportMatch("bright vs. simple", sbd.locations, bright.locations);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    std::string simulatedDir = VBTRACKER_SIMULATED_IMAGES_DIR;
+    std::string randomDir = VBTRACKER_RANDOM_IMAGES_DIR;
+    if (argc > 2) {
+        simulatedDir = argv[1];
+        randomDir = argv[2];
+    }
+
+    std::vector<std::vector<cv::Point2f> > truth;
+    auto synthetic = makeSyntheticFrames(truth);
+    compare("Synthetic Gaussian spots", synthetic, &truth);
+    compare("Simulated HDK video", loadFrames(simulatedDir), nullptr);
+    compare("HDK random images", loadFrames(randomDir), nullptr);
+    return 0;
+}
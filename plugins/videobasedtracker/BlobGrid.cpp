@@ -0,0 +1,151 @@
+/** @file
+    @brief Implementation of a uniform-grid spatial index of blob
+    measurements.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "BlobGrid.h"
+#include "LED.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+
+namespace osvr {
+namespace vbtracker {
+
+    /// @brief Upper bound on cells along each axis, so that a few blobs spread
+    /// far apart (or a tiny cell size) can't make the grid itself expensive.
+    static const int MAX_CELLS_PER_AXIS = 64;
+
+    const std::size_t BlobGrid::NOT_FOUND;
+
+    void BlobGrid::build(LedMeasurementList const &meas, float cellSize) {
+        m_points.clear();
+        m_points.reserve(meas.size());
+        for (auto const &m : meas) {
+            m_points.push_back(m.loc);
+        }
+        m_entries.resize(m_points.size());
+
+        if (m_points.empty()) {
+            m_cols = m_rows = 0;
+            m_cellStart.assign(1, 0);
+            return;
+        }
+
+        auto minPt = m_points.front();
+        auto maxPt = m_points.front();
+        for (auto const &pt : m_points) {
+            minPt.x = std::min(minPt.x, pt.x);
+            minPt.y = std::min(minPt.y, pt.y);
+            maxPt.x = std::max(maxPt.x, pt.x);
+            maxPt.y = std::max(maxPt.y, pt.y);
+        }
+        m_origin = minPt;
+        m_extent = maxPt - minPt;
+        auto extent = std::max(m_extent.x, m_extent.y);
+        m_cellSize = std::max({cellSize, 1.f, extent / MAX_CELLS_PER_AXIS});
+        m_cols = m_cellCoord(m_extent.x, MAX_CELLS_PER_AXIS) + 1;
+        m_rows = m_cellCoord(m_extent.y, MAX_CELLS_PER_AXIS) + 1;
+
+        // Counting sort of the blob indices by cell.
+        auto cellOf = [&](cv::Point2f const &pt) {
+            return m_cellCoord(pt.y - m_origin.y, m_rows) * m_cols +
+                   m_cellCoord(pt.x - m_origin.x, m_cols);
+        };
+        m_cellStart.assign(m_cols * m_rows + 1, 0);
+        for (auto const &pt : m_points) {
+            m_cellStart[cellOf(pt) + 1]++;
+        }
+        for (std::size_t c = 1; c < m_cellStart.size(); ++c) {
+            m_cellStart[c] += m_cellStart[c - 1];
+        }
+        std::vector<std::size_t> fill(begin(m_cellStart), end(m_cellStart) - 1);
+        for (std::size_t i = 0, n = m_points.size(); i < n; ++i) {
+            m_entries[fill[cellOf(m_points[i])]++] = i;
+        }
+    }
+
+    std::size_t BlobGrid::nearest(cv::Point2f const &loc, double threshold,
+                                  BlobClaims const &claims) const {
+        if (m_points.empty()) {
+            return NOT_FOUND;
+        }
+        auto radius = static_cast<float>(threshold);
+        auto dx = loc.x - m_origin.x;
+        auto dy = loc.y - m_origin.y;
+        // Reject searches that can't reach the blobs' bounding box at all.
+        if (dx + radius < 0 || dy + radius < 0 || dx - radius > m_extent.x ||
+            dy - radius > m_extent.y) {
+            return NOT_FOUND;
+        }
+        auto col0 = m_cellCoord(dx - radius, m_cols);
+        auto col1 = m_cellCoord(dx + radius, m_cols);
+        auto row0 = m_cellCoord(dy - radius, m_rows);
+        auto row1 = m_cellCoord(dy + radius, m_rows);
+
+        // Squaring the threshold to avoid doing a square-root in a tight loop.
+        auto thresholdSquared = threshold * threshold;
+        auto ret = NOT_FOUND;
+        float minDistSq = 0;
+        for (int row = row0; row <= row1; ++row) {
+            auto rowBase = row * m_cols;
+            auto b = m_cellStart[rowBase + col0];
+            auto e = m_cellStart[rowBase + col1 + 1];
+            for (auto it = b; it < e; ++it) {
+                auto i = m_entries[it];
+                if (claims.claimed(i)) {
+                    continue;
+                }
+                auto diff = loc - m_points[i];
+                auto distSq = diff.dot(diff);
+                if (distSq > thresholdSquared) {
+                    continue;
+                }
+                if (ret == NOT_FOUND || distSq < minDistSq ||
+                    (distSq == minDistSq && i < ret)) {
+                    minDistSq = distSq;
+                    ret = i;
+                }
+            }
+        }
+        return ret;
+    }
+
+    int BlobGrid::m_cellCoord(float offset, int dim) const {
+        auto cell = std::floor(offset / m_cellSize);
+        if (!(cell > 0)) {
+            return 0;
+        }
+        if (cell >= dim - 1) {
+            return dim - 1;
+        }
+        return static_cast<int>(cell);
+    }
+
+} // namespace vbtracker
+} // namespace osvr
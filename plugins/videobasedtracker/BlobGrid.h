@@ -0,0 +1,108 @@
+/** @file
+    @brief Header for a uniform-grid spatial index of the blob measurements in
+    a frame, used for nearest-neighbor association of tracked LEDs.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BlobGrid_h_GUID_D6322FB1_B1F7_4F56_A248_EE31AE4697CF
+#define INCLUDED_BlobGrid_h_GUID_D6322FB1_B1F7_4F56_A248_EE31AE4697CF
+
+// Internal Includes
+#include "Types.h"
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+
+// Standard includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace osvr {
+namespace vbtracker {
+
+    /// @brief Which of a frame's blobs have been claimed by an LED during one
+    /// sensor's association pass.
+    class BlobClaims {
+      public:
+        /// @brief Releases all claims, for a frame of @p n blobs.
+        void reset(std::size_t n) { m_claimed.assign(n, 0); }
+
+        void claim(std::size_t i) { m_claimed[i] = 1; }
+        bool claimed(std::size_t i) const { return m_claimed[i] != 0; }
+
+      private:
+        std::vector<std::uint8_t> m_claimed;
+    };
+
+    /// @brief Spatial index over the (undistorted) blob locations of a single
+    /// frame, built once and shared by all sensors' LED association passes.
+    ///
+    /// Blobs are bucketed into square cells, so a nearest-neighbor query only
+    /// looks at the cells within the search radius instead of every blob.
+    /// The grid is not modified by queries, so the sensors can search it
+    /// concurrently: each keeps its own BlobClaims to record which blobs its
+    /// LEDs have taken, instead of a copy of the measurement list.
+    class BlobGrid {
+      public:
+        /// @brief Value returned by nearest() when there is no match.
+        static const std::size_t NOT_FOUND = static_cast<std::size_t>(-1);
+
+        /// @brief Rebuilds the index over the given measurements, with the
+        /// given cell edge length in pixels (a typical search radius is a
+        /// good choice).
+        void build(LedMeasurementList const &meas, float cellSize);
+
+        /// @brief Finds the closest blob within @p threshold pixels of @p loc
+        /// not already in @p claims. Ties go to the lowest index, matching a
+        /// linear scan.
+        ///
+        /// @return the blob's index in the measurement list, or NOT_FOUND.
+        std::size_t nearest(cv::Point2f const &loc, double threshold,
+                            BlobClaims const &claims) const;
+
+        std::size_t size() const { return m_points.size(); }
+
+      private:
+        /// @brief Cell coordinate along one axis for an offset from the grid
+        /// origin, clamped to [0, dim - 1].
+        int m_cellCoord(float offset, int dim) const;
+
+        std::vector<cv::Point2f> m_points;
+        /// Blob indices, sorted by cell.
+        std::vector<std::size_t> m_entries;
+        /// Where each cell's run starts in m_entries: cell c is
+        /// [m_cellStart[c], m_cellStart[c + 1]).
+        std::vector<std::size_t> m_cellStart;
+        /// Minimum corner of the blobs' bounding box
+        cv::Point2f m_origin;
+        /// Size of the blobs' bounding box
+        cv::Point2f m_extent;
+        float m_cellSize = 1.f;
+        int m_cols = 0;
+        int m_rows = 0;
+    };
+
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_BlobGrid_h_GUID_D6322FB1_B1F7_4F56_A248_EE31AE4697CF
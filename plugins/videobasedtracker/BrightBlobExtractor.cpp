@@ -0,0 +1,228 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "BrightBlobExtractor.h"
+
+// Library/third-party includes
+#include <opencv2/imgproc/imgproc.hpp>
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+
+namespace osvr {
+namespace vbtracker {
+    BrightBlobExtractor::BrightBlobExtractor(ConfigParams const &params,
+                                             BrightPixelScan scan)
+        : m_params(params),
+          m_findBrightPixel(getBrightPixelScanFunction(scan)) {}
+
+    BrightBlobExtractor::~BrightBlobExtractor() {}
+
+    std::vector<LedMeasurement> const &
+    BrightBlobExtractor::extractBlobs(cv::Mat const &grayImage) {
+        m_latestMeasurements.clear();
+        if (m_params.debug) {
+            grayImage.copyTo(m_lastGrayImage);
+        }
+        m_debugThresholdImageDirty = true;
+        m_debugBlobImageDirty = true;
+
+        double minVal, maxVal;
+        cv::minMaxIdx(grayImage, &minVal, &maxVal);
+        auto &p = m_params.blobParams;
+        if (maxVal < p.absoluteMinThreshold) {
+            /// empty image, early out!
+            m_lastThreshold = 255;
+            return m_latestMeasurements;
+        }
+        // Same as the lowest threshold SBDBlobExtractor uses.
+        auto thresh =
+            std::max(minVal + (maxVal - minVal) * p.minThresholdAlpha,
+                     p.absoluteMinThreshold);
+        m_lastThreshold = static_cast<std::uint8_t>(
+            std::min(std::floor(thresh), 255.));
+
+        m_label(grayImage, m_lastThreshold);
+
+        for (std::size_t i = 0, e = m_blobs.size(); i < e; ++i) {
+            auto const &blob = m_blobs[i];
+            if (blob.parent != i || blob.area < p.minArea) {
+                // Merged into another, or too small.
+                continue;
+            }
+            LedMeasurement meas;
+            auto weight = static_cast<double>(blob.sumWeight);
+            meas.loc = cv::Point2f(
+                static_cast<float>(blob.sumWeightedX / weight),
+                static_cast<float>(blob.sumWeightedY / weight));
+            meas.area = static_cast<float>(blob.area);
+            meas.diameter =
+                static_cast<float>(2 * std::sqrt(meas.area / CV_PI));
+            meas.brightness = meas.diameter;
+            meas.knowBoundingBox = true;
+            meas.boundingBox =
+                cv::Size2f(static_cast<float>(blob.maxX - blob.minX + 1),
+                           static_cast<float>(blob.maxY - blob.minY + 1));
+            m_latestMeasurements.push_back(meas);
+        }
+        return m_latestMeasurements;
+    }
+
+    void BrightBlobExtractor::m_label(cv::Mat const &grayImage,
+                                      std::uint8_t threshold) {
+        m_blobs.clear();
+        m_prevRuns.clear();
+        const std::size_t NO_LABEL = static_cast<std::size_t>(-1);
+        auto cols = grayImage.cols;
+        auto findBrightPixel = m_findBrightPixel;
+        for (int y = 0; y < grayImage.rows; ++y) {
+            auto row = grayImage.ptr<std::uint8_t>(y);
+            m_curRuns.clear();
+            std::size_t prevIdx = 0;
+            auto numPrev = m_prevRuns.size();
+            int x = 0;
+            while ((x = findBrightPixel(row, x, cols, threshold)) < cols) {
+                int end = x + 1;
+                while (end < cols && row[end] > threshold) {
+                    ++end;
+                }
+                // Runs on the previous row are in order, and those ending
+                // before this one starts (allowing for diagonal neighbors)
+                // can't touch this one or any later one.
+                while (prevIdx < numPrev && m_prevRuns[prevIdx].end < x) {
+                    ++prevIdx;
+                }
+                auto label = NO_LABEL;
+                for (auto j = prevIdx;
+                     j < numPrev && m_prevRuns[j].begin <= end; ++j) {
+                    auto root = m_findRoot(m_prevRuns[j].label);
+                    if (label == NO_LABEL) {
+                        label = root;
+                    } else if (root != label) {
+                        m_merge(label, root);
+                    }
+                }
+                if (label == NO_LABEL) {
+                    label = m_blobs.size();
+                    BlobStats blob = {label, 0, 0, 0, 0, x, end - 1, y, y};
+                    m_blobs.push_back(blob);
+                }
+                m_accumulate(m_blobs[label], row, y, x, end, threshold);
+                Run run = {x, end, label};
+                m_curRuns.push_back(run);
+                // The pixel at end, if any, is known to be dark.
+                x = end + 1;
+            }
+            m_prevRuns.swap(m_curRuns);
+        }
+    }
+
+    void BrightBlobExtractor::m_accumulate(BlobStats &blob,
+                                           std::uint8_t const *row, int y,
+                                           int begin, int end,
+                                           std::uint8_t threshold) {
+        std::uint64_t sumWeight = 0;
+        std::uint64_t sumWeightedX = 0;
+        for (int x = begin; x < end; ++x) {
+            // Weight by height above the threshold, so pixels enter and
+            // leave the blob with (close to) no weight.
+            std::uint64_t weight = row[x] - threshold;
+            sumWeight += weight;
+            sumWeightedX += weight * static_cast<std::uint64_t>(x);
+        }
+        blob.area += static_cast<std::uint64_t>(end - begin);
+        blob.sumWeight += sumWeight;
+        blob.sumWeightedX += sumWeightedX;
+        blob.sumWeightedY += sumWeight * static_cast<std::uint64_t>(y);
+        blob.minX = std::min(blob.minX, begin);
+        blob.maxX = std::max(blob.maxX, end - 1);
+        blob.maxY = y;
+    }
+
+    std::size_t BrightBlobExtractor::m_findRoot(std::size_t label) {
+        auto root = label;
+        while (m_blobs[root].parent != root) {
+            root = m_blobs[root].parent;
+        }
+        // Compress the path for next time.
+        while (m_blobs[label].parent != root) {
+            auto next = m_blobs[label].parent;
+            m_blobs[label].parent = root;
+            label = next;
+        }
+        return root;
+    }
+
+    void BrightBlobExtractor::m_merge(std::size_t into, std::size_t from) {
+        auto &dest = m_blobs[into];
+        auto &src = m_blobs[from];
+        src.parent = into;
+        dest.area += src.area;
+        dest.sumWeight += src.sumWeight;
+        dest.sumWeightedX += src.sumWeightedX;
+        dest.sumWeightedY += src.sumWeightedY;
+        dest.minX = std::min(dest.minX, src.minX);
+        dest.maxX = std::max(dest.maxX, src.maxX);
+        dest.minY = std::min(dest.minY, src.minY);
+        dest.maxY = std::max(dest.maxY, src.maxY);
+    }
+
+    cv::Mat const &BrightBlobExtractor::getDebugThresholdImage() {
+        if (m_debugThresholdImageDirty) {
+            m_debugThresholdImage = cv::Mat();
+            if (!m_lastGrayImage.empty()) {
+                cv::threshold(m_lastGrayImage, m_debugThresholdImage,
+                              m_lastThreshold, 255, CV_THRESH_BINARY);
+            }
+            m_debugThresholdImageDirty = false;
+        }
+        return m_debugThresholdImage;
+    }
+
+    cv::Mat const &BrightBlobExtractor::getDebugBlobImage() {
+        if (m_debugBlobImageDirty) {
+            m_debugBlobImage = cv::Mat();
+            if (!m_lastGrayImage.empty()) {
+                cv::cvtColor(m_lastGrayImage, m_debugBlobImage,
+                             CV_GRAY2BGR);
+                // Draw detected blobs as blue circles.
+                for (auto const &meas : m_latestMeasurements) {
+                    cv::circle(m_debugBlobImage, meas.loc,
+                               static_cast<int>(meas.diameter / 2 + 0.5f),
+                               cv::Scalar(255, 0, 0));
+                }
+            }
+            m_debugBlobImageDirty = false;
+        }
+        return m_debugBlobImage;
+    }
+
+    cv::Mat const &BrightBlobExtractor::getDebugExtraImage() {
+        return m_extraImage;
+    }
+
+} // namespace vbtracker
+} // namespace osvr
@@ -0,0 +1,130 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BrightBlobExtractor_h_GUID_5881DCCC_2584_4043_806E_47CD20C37A18
+#define INCLUDED_BrightBlobExtractor_h_GUID_5881DCCC_2584_4043_806E_47CD20C37A18
+
+// Internal Includes
+#include "BlobExtractor.h"
+#include "BrightPixelScan.h"
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+
+// Standard includes
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace osvr {
+namespace vbtracker {
+    /// @brief A blob extractor specialized for what the tracking camera sees:
+    /// small bright LEDs on a dark background.
+    ///
+    /// Instead of building contours at several thresholds, it thresholds once
+    /// (at the lowest level SBDBlobExtractor would use) and labels the
+    /// 8-connected components in a single pass over the image, run by run.
+    /// The dark stretches that make up most of each row are skipped with
+    /// vector instructions where available (SSE2, or AVX2 if the processor
+    /// supports it). Each blob's location is its centroid weighted by how far
+    /// each pixel is above the threshold, so it moves smoothly, with subpixel
+    /// precision, as pixels enter and leave the blob.
+    ///
+    /// Of the blob parameters, only the thresholds and minArea apply: there
+    /// are no shape filters.
+    class BrightBlobExtractor : public BlobExtractor {
+      public:
+        /// @param scan The row scan to use: the tests pick each one in turn,
+        /// otherwise the fastest available is best.
+        explicit BrightBlobExtractor(
+            ConfigParams const &params,
+            BrightPixelScan scan = getBestBrightPixelScan());
+        ~BrightBlobExtractor() override;
+        std::vector<LedMeasurement> const &
+        extractBlobs(cv::Mat const &grayImage) override;
+
+        cv::Mat const &getDebugThresholdImage() override;
+        cv::Mat const &getDebugBlobImage() override;
+        /// @brief Not provided by this extractor: always empty.
+        cv::Mat const &getDebugExtraImage() override;
+
+      private:
+        /// @brief A horizontal run of above-threshold pixels, [begin, end).
+        struct Run {
+            int begin;
+            int end;
+            std::size_t label;
+        };
+
+        /// @brief Statistics of a connected component, or of a part of one
+        /// that has since been merged into its parent.
+        struct BlobStats {
+            std::size_t parent;
+            std::uint64_t area;
+            std::uint64_t sumWeight;
+            std::uint64_t sumWeightedX;
+            std::uint64_t sumWeightedY;
+            int minX;
+            int maxX;
+            int minY;
+            int maxY;
+        };
+
+        /// @brief Labels the connected components of the pixels above the
+        /// threshold, filling m_blobs.
+        void m_label(cv::Mat const &grayImage, std::uint8_t threshold);
+
+        /// @brief Adds a run's pixels to the statistics of a blob.
+        void m_accumulate(BlobStats &blob, std::uint8_t const *row, int y,
+                          int begin, int end, std::uint8_t threshold);
+
+        /// @brief Finds the blob a label has been merged into.
+        std::size_t m_findRoot(std::size_t label);
+
+        /// @brief Merges the blob with root @p from into the one with root
+        /// @p into.
+        void m_merge(std::size_t into, std::size_t from);
+
+        ConfigParams m_params;
+        BrightPixelScanFunction m_findBrightPixel;
+        std::vector<Run> m_prevRuns;
+        std::vector<Run> m_curRuns;
+        std::vector<BlobStats> m_blobs;
+        std::vector<LedMeasurement> m_latestMeasurements;
+
+        std::uint8_t m_lastThreshold = 0;
+        cv::Mat m_lastGrayImage;
+
+        bool m_debugThresholdImageDirty = true;
+        cv::Mat m_debugThresholdImage;
+
+        bool m_debugBlobImageDirty = true;
+        cv::Mat m_debugBlobImage;
+
+        cv::Mat m_extraImage;
+    };
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_BrightBlobExtractor_h_GUID_5881DCCC_2584_4043_806E_47CD20C37A18
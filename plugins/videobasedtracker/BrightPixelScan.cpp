@@ -0,0 +1,169 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "BrightPixelScan.h"
+
+// Library/third-party includes
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OSVR_VBTRACKER_HAVE_SSE2_SCAN
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace vbtracker {
+    namespace {
+        int findBrightPixelScalar(std::uint8_t const *row, int x, int cols,
+                                  std::uint8_t threshold) {
+            for (; x < cols; ++x) {
+                if (row[x] > threshold) {
+                    return x;
+                }
+            }
+            return cols;
+        }
+
+#ifdef OSVR_VBTRACKER_HAVE_SSE2_SCAN
+        /// @brief Index of the lowest set bit of a non-zero mask.
+        inline int lowestSetBit(unsigned mask) {
+#ifdef _MSC_VER
+            unsigned long idx;
+            _BitScanForward(&idx, mask);
+            return static_cast<int>(idx);
+#else
+            return __builtin_ctz(mask);
+#endif
+        }
+
+        int findBrightPixelSSE2(std::uint8_t const *row, int x, int cols,
+                                std::uint8_t threshold) {
+            // For unsigned bytes, px > threshold exactly when
+            // max(px, threshold) != threshold: there is no unsigned byte
+            // comparison.
+            const __m128i thresh128 =
+                _mm_set1_epi8(static_cast<char>(threshold));
+            for (; x + 16 <= cols; x += 16) {
+                __m128i px =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const *>(row + x));
+                __m128i dark =
+                    _mm_cmpeq_epi8(_mm_max_epu8(px, thresh128), thresh128);
+                auto mask =
+                    ~static_cast<unsigned>(_mm_movemask_epi8(dark)) & 0xffffu;
+                if (mask) {
+                    return x + lowestSetBit(mask);
+                }
+            }
+            return findBrightPixelScalar(row, x, cols, threshold);
+        }
+#endif // OSVR_VBTRACKER_HAVE_SSE2_SCAN
+
+#ifdef OSVR_VBTRACKER_HAVE_AVX2_SCAN
+        /// @brief Whether the processor and operating system support AVX2.
+        bool processorHasAVX2() {
+#ifdef _MSC_VER
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) {
+                return false;
+            }
+            __cpuid(info, 1);
+            // OSXSAVE and AVX
+            const int osxsaveAndAvx = (1 << 27) | (1 << 28);
+            if ((info[2] & osxsaveAndAvx) != osxsaveAndAvx) {
+                return false;
+            }
+            // The OS saves the SSE and AVX registers.
+            if ((_xgetbv(0) & 0x6) != 0x6) {
+                return false;
+            }
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            return __builtin_cpu_supports("avx2") != 0;
+#endif
+        }
+#endif // OSVR_VBTRACKER_HAVE_AVX2_SCAN
+    } // namespace
+
+    bool isBrightPixelScanAvailable(BrightPixelScan scan) {
+        switch (scan) {
+        case BrightPixelScan::Scalar:
+            return true;
+        case BrightPixelScan::SSE2:
+#ifdef OSVR_VBTRACKER_HAVE_SSE2_SCAN
+            return true;
+#else
+            return false;
+#endif
+        case BrightPixelScan::AVX2:
+#ifdef OSVR_VBTRACKER_HAVE_AVX2_SCAN
+        {
+            static const bool available = processorHasAVX2();
+            return available;
+        }
+#else
+            return false;
+#endif
+        }
+        return false;
+    }
+
+    BrightPixelScan getBestBrightPixelScan() {
+        if (isBrightPixelScanAvailable(BrightPixelScan::AVX2)) {
+            return BrightPixelScan::AVX2;
+        }
+        if (isBrightPixelScanAvailable(BrightPixelScan::SSE2)) {
+            return BrightPixelScan::SSE2;
+        }
+        return BrightPixelScan::Scalar;
+    }
+
+    BrightPixelScanFunction getBrightPixelScanFunction(BrightPixelScan scan) {
+        if (!isBrightPixelScanAvailable(scan)) {
+            return &findBrightPixelScalar;
+        }
+        switch (scan) {
+#ifdef OSVR_VBTRACKER_HAVE_AVX2_SCAN
+        case BrightPixelScan::AVX2:
+            return &detail::findBrightPixelAVX2;
+#endif
+#ifdef OSVR_VBTRACKER_HAVE_SSE2_SCAN
+        case BrightPixelScan::SSE2:
+            return &findBrightPixelSSE2;
+#endif
+        default:
+            return &findBrightPixelScalar;
+        }
+    }
+
+} // namespace vbtracker
+} // namespace osvr
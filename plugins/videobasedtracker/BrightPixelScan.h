@@ -0,0 +1,69 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BrightPixelScan_h_GUID_E2B90395_0F49_4405_BB28_5DB4B39AEB43
+#define INCLUDED_BrightPixelScan_h_GUID_E2B90395_0F49_4405_BB28_5DB4B39AEB43
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <cstdint>
+
+namespace osvr {
+namespace vbtracker {
+    /// @brief The implementations of the search for the next bright pixel in
+    /// a row, which is where BrightBlobExtractor spends most of its time.
+    enum class BrightPixelScan { Scalar, SSE2, AVX2 };
+
+    /// @brief Finds the first pixel of @p row in [x, cols) above
+    /// @p threshold, returning cols if there is none.
+    typedef int (*BrightPixelScanFunction)(std::uint8_t const *row, int x,
+                                           int cols, std::uint8_t threshold);
+
+    /// @brief Whether this build includes @p scan and this processor can run
+    /// it.
+    bool isBrightPixelScanAvailable(BrightPixelScan scan);
+
+    /// @brief The fastest scan available.
+    BrightPixelScan getBestBrightPixelScan();
+
+    /// @brief The function implementing @p scan, or the scalar one if it isn't
+    /// available.
+    BrightPixelScanFunction getBrightPixelScanFunction(BrightPixelScan scan);
+
+    namespace detail {
+        /// @brief The AVX2 scan: only built (and only safe to call) when
+        /// OSVR_VBTRACKER_HAVE_AVX2_SCAN is defined and the processor
+        /// supports AVX2.
+        int findBrightPixelAVX2(std::uint8_t const *row, int x, int cols,
+                                std::uint8_t threshold);
+    } // namespace detail
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_BrightPixelScan_h_GUID_E2B90395_0F49_4405_BB28_5DB4B39AEB43
@@ -0,0 +1,103 @@
+/** @file
+    @brief Implementation of the AVX2 bright pixel scan.
+
+    This is the only file built with AVX2 enabled, and it must stay
+    self-contained: any inline function it shared with other files (from a
+    library header, say) could be compiled with AVX2 instructions here and
+    then picked by the linker for callers on processors without them.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "BrightPixelScan.h"
+
+#ifdef OSVR_VBTRACKER_HAVE_AVX2_SCAN
+
+// Library/third-party includes
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace vbtracker {
+    namespace {
+        /// @brief Index of the lowest set bit of a non-zero mask.
+        inline int lowestSetBit(unsigned mask) {
+#ifdef _MSC_VER
+            unsigned long idx;
+            _BitScanForward(&idx, mask);
+            return static_cast<int>(idx);
+#else
+            return __builtin_ctz(mask);
+#endif
+        }
+    } // namespace
+
+    namespace detail {
+        int findBrightPixelAVX2(std::uint8_t const *row, int x, int cols,
+                                std::uint8_t threshold) {
+            // For unsigned bytes, px > threshold exactly when
+            // max(px, threshold) != threshold: there is no unsigned byte
+            // comparison.
+            const __m256i thresh256 =
+                _mm256_set1_epi8(static_cast<char>(threshold));
+            for (; x + 32 <= cols; x += 32) {
+                __m256i px = _mm256_loadu_si256(
+                    reinterpret_cast<__m256i const *>(row + x));
+                __m256i dark = _mm256_cmpeq_epi8(
+                    _mm256_max_epu8(px, thresh256), thresh256);
+                auto mask =
+                    ~static_cast<unsigned>(_mm256_movemask_epi8(dark));
+                if (mask) {
+                    return x + lowestSetBit(mask);
+                }
+            }
+            const __m128i thresh128 =
+                _mm_set1_epi8(static_cast<char>(threshold));
+            for (; x + 16 <= cols; x += 16) {
+                __m128i px =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const *>(row + x));
+                __m128i dark =
+                    _mm_cmpeq_epi8(_mm_max_epu8(px, thresh128), thresh128);
+                auto mask =
+                    ~static_cast<unsigned>(_mm_movemask_epi8(dark)) & 0xffffu;
+                if (mask) {
+                    return x + lowestSetBit(mask);
+                }
+            }
+            for (; x < cols; ++x) {
+                if (row[x] > threshold) {
+                    return x;
+                }
+            }
+            return cols;
+        }
+    } // namespace detail
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // OSVR_VBTRACKER_HAVE_AVX2_SCAN
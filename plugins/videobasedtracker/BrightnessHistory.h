@@ -0,0 +1,93 @@
+/** @file
+    @brief Header for a fixed-capacity ring buffer of LED brightness samples.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BrightnessHistory_h_GUID_C6B42847_CC25_490E_95FE_A39A6127D15B
+#define INCLUDED_BrightnessHistory_h_GUID_C6B42847_CC25_490E_95FE_A39A6127D15B
+
+// Internal Includes
+#include "Types.h"
+
+// Library/third-party includes
+#include <boost/assert.hpp>
+
+// Standard includes
+#include <array>
+#include <cstddef>
+
+namespace osvr {
+namespace vbtracker {
+
+    /// @brief The most recent brightness samples of an LED, oldest first.
+    ///
+    /// Storage is a fixed array used as a ring, so recording a sample per
+    /// frame never allocates. Once full, pushing a new sample drops the
+    /// oldest one.
+    class BrightnessHistory {
+      public:
+        /// @brief Maximum number of samples kept: also the maximum supported
+        /// blink pattern length. Must be a power of two.
+        static const std::size_t CAPACITY = 32;
+
+        void push_back(Brightness b) {
+            if (m_size == CAPACITY) {
+                m_start = (m_start + 1) & MASK;
+            } else {
+                ++m_size;
+            }
+            m_data[(m_start + m_size - 1) & MASK] = b;
+        }
+
+        /// @brief Drops the oldest samples until at most @p n remain.
+        void truncateTo(std::size_t n) {
+            if (m_size > n) {
+                m_start = (m_start + (m_size - n)) & MASK;
+                m_size = n;
+            }
+        }
+
+        void clear() { m_start = m_size = 0; }
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        /// @brief Accesses the @p i th oldest sample.
+        Brightness operator[](std::size_t i) const {
+            BOOST_ASSERT_MSG(i < m_size, "Index out of range!");
+            return m_data[(m_start + i) & MASK];
+        }
+
+        /// @brief Accesses the newest sample.
+        Brightness back() const { return (*this)[m_size - 1]; }
+
+      private:
+        static const std::size_t MASK = CAPACITY - 1;
+        std::array<Brightness, CAPACITY> m_data;
+        std::size_t m_start = 0;
+        std::size_t m_size = 0;
+    };
+
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_BrightnessHistory_h_GUID_C6B42847_CC25_490E_95FE_A39A6127D15B
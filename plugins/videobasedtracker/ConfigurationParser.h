@@ -33,7 +33,8 @@
 #include <json/value.h>
 
 // Standard includes
-// - none
+#include <iostream>
+#include <string>
 
 namespace osvr {
 namespace vbtracker {
@@ -69,6 +70,9 @@ namespace vbtracker {
         getOptionalParameter(config.blobsKeepIdentity, root,
                              "blobsKeepIdentity");
         getOptionalParameter(config.numThreads, root, "numThreads");
+        getOptionalParameter(config.pipelined, root, "pipelined");
+        getOptionalParameter(config.poseEstimationThreads, root,
+                             "poseEstimationThreads");
         getOptionalParameter(config.streamBeaconDebugInfo, root,
                              "streamBeaconDebugInfo");
         getOptionalParameter(config.offsetToCentroid, root, "offsetToCentroid");
@@ -100,6 +104,17 @@ namespace vbtracker {
         if (root.isMember("blobParams")) {
             Json::Value const &blob = root["blobParams"];
 
+            std::string extractor = blob.get("extractor", "").asString();
+            if (extractor == "simple") {
+                config.blobParams.extractor =
+                    BlobExtractorType::SimpleBlobDetector;
+            } else if (extractor == "bright") {
+                config.blobParams.extractor = BlobExtractorType::BrightBlob;
+            } else if (!extractor.empty()) {
+                std::cerr << "Video-based tracker: unrecognized blob "
+                             "extractor '"
+                          << extractor << "', using the default." << std::endl;
+            }
             getOptionalParameter(config.blobParams.absoluteMinThreshold, blob,
                                  "absoluteMinThreshold");
             getOptionalParameter(config.blobParams.minDistBetweenBlobs, blob,
@@ -62,13 +62,17 @@ namespace vbtracker {
             return;
         }
 
-        // Decode each string into a new list of boolean values, making
-        // sure each have the correct length.
+        if (d_length > BrightnessHistory::CAPACITY) {
+            throw std::runtime_error("Got a pattern longer than supported!");
+        }
 
+        // Decode each string into a bitmask, making sure each have the
+        // correct length.
+        int index = -1;
         for (auto &pat : PATTERNS) {
+            ++index;
             if (pat.empty() || pat.find_first_not_of(VALIDCHARS) != pat.npos) {
                 // This is an intentionally disabled beacon/pattern.
-                d_patterns.emplace_back();
                 continue;
             }
 
@@ -77,19 +81,22 @@ namespace vbtracker {
                 throw std::runtime_error("Got a pattern of incorrect length!");
             }
 
-            // Make a wrapped pattern, which is the original pattern plus
-            // a second copy of the pattern that has all but the last
-            // character in it.  This will enable use to use the string
-            // find() routine to see if any shift of the pattern is a
-            // match.
-            auto wrapped = pat + pat;
-            wrapped.pop_back();
-            d_patterns.push_back(std::move(wrapped));
+            // Pack the pattern into a bitmask (first character in bit 0)
+            // and index it by its canonical rotation, so that any shift of
+            // it can be matched with a single lookup. If another pattern is
+            // a rotation of this one, the earlier one wins.
+            std::uint32_t bits = 0;
+            for (size_t i = 0; i < d_length; ++i) {
+                if (pat[i] == '*') {
+                    bits |= std::uint32_t(1) << i;
+                }
+            }
+            d_patternIds.emplace(canonicalRotation(bits, d_length), index);
         }
     }
 
     int OsvrHdkLedIdentifier::getId(int currentId,
-                                    std::list<float> &brightnesses,
+                                    BrightnessHistory &brightnesses,
                                     bool &lastBright, bool blobsKeepId) const {
         // If we don't have at least the required number of frames of data, we
         // don't know anything.
@@ -98,7 +105,7 @@ namespace vbtracker {
         }
 
         // We only care about the d_length most-recent levels.
-        truncateBrightnessListTo(brightnesses, d_length);
+        brightnesses.truncateTo(d_length);
 
         // Compute the minimum and maximum brightness values.  If
         // they are too close to each other, we have a light rather
@@ -121,25 +128,18 @@ namespace vbtracker {
             return currentId;
         }
 
-        // Get a list of boolean values for 0's and 1's using
-        // the threshold computed above.
-        auto bits = getBitsUsingThreshold(brightnesses, threshold);
-
-        // Search through the available patterns to see if the passed-in
-        // pattern matches any of them.  If so, return that pattern.  We
-        // need to check all potential rotations of the pattern, since we
-        // don't know when the code started.  For the HDK, the codes are
-        // rotationally invariant.  We do this by making wrapped strings
-        // and seeing if the pattern shows up anywhe in them, relying on
-        // the std::string find method to do efficiently.
-        for (size_t i = 0; i < d_patterns.size(); i++) {
-            if (d_patterns[i].empty()) {
-                /// Skip turned-off patterns.
-                continue;
-            }
-            if (d_patterns[i].find(bits) != std::string::npos) {
-                return static_cast<int>(i);
-            }
+        // Get a bitmask of 0's and 1's using the threshold computed above.
+        auto bits = getBitmaskUsingThreshold(brightnesses, threshold);
+
+        // See if the passed-in pattern matches any of the available ones.
+        // If so, return that pattern.  We need to check all potential
+        // rotations of the pattern, since we don't know when the code
+        // started.  For the HDK, the codes are rotationally invariant. We do
+        // this by looking up the canonical (smallest) rotation, which the
+        // patterns were indexed by.
+        auto it = d_patternIds.find(canonicalRotation(bits, d_length));
+        if (it != end(d_patternIds)) {
+            return it->second;
         }
 
         // No pattern recognized and we should have recognized one, so return
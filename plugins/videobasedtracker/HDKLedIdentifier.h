@@ -32,7 +32,8 @@
 // - none
 
 // Standard includes
-// - none
+#include <cstdint>
+#include <unordered_map>
 
 namespace osvr {
 namespace vbtracker {
@@ -42,21 +43,23 @@ namespace vbtracker {
         /// @brief Give it a list of patterns to use.  There is a string for
         /// each LED, and each is encoded with '*' meaning that the LED is
         /// bright and '.' that it is dim at this point in time. All patterns
-        /// must have the same length.
+        /// must have the same length, of at most
+        /// BrightnessHistory::CAPACITY.
         OsvrHdkLedIdentifier(const PatternStringList &PATTERNS);
 
         ~OsvrHdkLedIdentifier() override;
 
-        /// @brief Determine an ID based on a list of brightnesses
-        /// This truncates the passed-in list to only as many elements
-        /// as are in the pattern list, to keep it from growing too
-        /// large and wasting time and space.
-        int getId(int currentId, BrightnessList &brightnesses, bool &lastBright,
-                  bool blobsKeepId) const override;
+        /// @brief Determine an ID based on a history of brightnesses
+        /// This truncates the passed-in history to only as many elements
+        /// as are in the pattern list.
+        int getId(int currentId, BrightnessHistory &brightnesses,
+                  bool &lastBright, bool blobsKeepId) const override;
 
       private:
-        size_t d_length;        //< Length of all patterns
-        PatternList d_patterns; //< Patterns by index
+        size_t d_length; //< Length of all patterns
+        /// @brief Maps the canonical rotation of each enabled pattern's
+        /// bitmask to its index (the lowest index, if patterns repeat).
+        std::unordered_map<std::uint32_t, int> d_patternIds;
     };
 
 } // End namespace vbtracker
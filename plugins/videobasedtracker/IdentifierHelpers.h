@@ -27,54 +27,60 @@
 
 // Internal Includes
 #include "Types.h"
+#include "BrightnessHistory.h"
 
 // Library/third-party includes
 #include <boost/assert.hpp>
 
 // Standard includes
 #include <algorithm>
+#include <cstdint>
 
 namespace osvr {
 namespace vbtracker {
 
-    /// @brief Helper for implementations of LedIdentifier to truncate the
-    /// passed-in brightness list to the maximum useful length.
-    inline void truncateBrightnessListTo(BrightnessList &brightnesses,
-                                         size_t n) {
-        /// @todo has to be a more efficient method.
-        while (brightnesses.size() > n) {
-            brightnesses.pop_front();
-        }
-    }
-
     /// @brief Helper function for implementations of LedIdentifier to find
-    /// the minimum and maximum values in a non-empty list of brightnesses.
+    /// the minimum and maximum values in a non-empty brightness history.
     inline BrightnessMinMax
-    findMinMaxBrightness(const BrightnessList &brightnesses) {
+    findMinMaxBrightness(const BrightnessHistory &brightnesses) {
 
         BOOST_ASSERT_MSG(!brightnesses.empty(), "Must be a non-empty list!");
-        auto extremaIterators =
-            std::minmax_element(begin(brightnesses), end(brightnesses));
-        return std::make_pair(*extremaIterators.first,
-                              *extremaIterators.second);
+        auto minVal = brightnesses[0];
+        auto maxVal = brightnesses[0];
+        for (std::size_t i = 1, n = brightnesses.size(); i < n; ++i) {
+            minVal = std::min(minVal, brightnesses[i]);
+            maxVal = std::max(maxVal, brightnesses[i]);
+        }
+        return std::make_pair(minVal, maxVal);
     }
 
     /// @brief Helper for implementations of LedIdentifier to turn a
-    /// brightness list into a boolean list based on thresholding on the
-    /// halfway point between minimum and maximum brightness.
-    inline LedPatternWrapped getBitsUsingThreshold(const BrightnessList &brightnesses,
-                                            float threshold) {
-        LedPatternWrapped ret;
-        // Allocate output space for our transform.
-        ret.resize(brightnesses.size());
-
-        // Transform the brightnesses into a string with '.' for dim
-        // and '*' for bright.
-        std::transform(
-            begin(brightnesses), end(brightnesses), begin(ret),
-            [threshold](Brightness val) {
-          if (val >= threshold) { return '*'; } else { return '.'; } });
+    /// brightness history into a bitmask based on thresholding on the
+    /// halfway point between minimum and maximum brightness: bit i is set if
+    /// the i th oldest sample is bright.
+    inline std::uint32_t
+    getBitmaskUsingThreshold(const BrightnessHistory &brightnesses,
+                             float threshold) {
+        std::uint32_t ret = 0;
+        for (std::size_t i = 0, n = brightnesses.size(); i < n; ++i) {
+            if (brightnesses[i] >= threshold) {
+                ret |= std::uint32_t(1) << i;
+            }
+        }
+        return ret;
+    }
 
+    /// @brief Returns the smallest of all rotations of a bitmask of the given
+    /// length (at most 32): two patterns are rotations of each other if and
+    /// only if their canonical rotations are equal.
+    inline std::uint32_t canonicalRotation(std::uint32_t bits,
+                                           std::size_t length) {
+        BOOST_ASSERT_MSG(length > 0 && length <= 32, "Invalid pattern length");
+        auto ret = bits;
+        for (std::size_t i = 1; i < length; ++i) {
+            bits = (bits >> 1) | ((bits & 1u) << (length - 1));
+            ret = std::min(ret, bits);
+        }
         return ret;
     }
 } // End namespace vbtracker
@@ -48,6 +48,11 @@ namespace vbtracker {
     /// onward as an image source (looping)
     ImageSourcePtr openImageFileSequence(std::string const &dir);
 
+    /// Factory method to play back a directory of tif files named 0001.tif
+    /// and onward once, without delay, mapping and decoding each only when
+    /// it's reached: grab() fails after the last one.
+    ImageSourcePtr openImageFileSequenceReplay(std::string const &dir);
+
     /// Factory method to wrap an image source, already determined to be an
     /// Oculus DK2 camera, with unscrambling and keep-alive code.
     ImageSourcePtr openDK2WrappedCamera(ImageSourcePtr &&cam, bool doHid);
@@ -71,84 +71,6 @@ namespace vbtracker {
         }
     }
 
-    KeyPointIterator Led::nearest(KeyPointList &keypoints,
-                                  double threshold) const {
-        // If we have no elements in the vector, return the end().
-        if (keypoints.empty()) {
-            return end(keypoints);
-        }
-
-        // Squaring the threshold to avoid doing a square-root in a tight loop.
-        auto thresholdSquared = threshold * threshold;
-        auto location = getLocation();
-
-        auto computeDistSquared = [location](KeyPointIterator it) {
-            auto diff = (location - it->pt);
-            return diff.dot(diff);
-        };
-
-        // Find the distance to the first point and record it as the
-        // current minimum distance;
-        auto ret = begin(keypoints);
-        auto minDistSq = computeDistSquared(ret);
-
-        // Search the rest of the elements to see if we can find a
-        // better one.
-        for (auto it = begin(keypoints), e = end(keypoints); it != e; ++it) {
-            auto distSq = computeDistSquared(it);
-            if (distSq < minDistSq) {
-                minDistSq = distSq;
-                ret = it;
-            }
-        }
-
-        // If the closest is within the threshold, return it.  Otherwise,
-        // return the end.
-        if (minDistSq <= thresholdSquared) {
-            return ret;
-        }
-        return end(keypoints);
-    }
-
-    LedMeasurementIterator Led::nearest(LedMeasurementList &meas,
-                                        double threshold) const {
-        // If we have no elements in the vector, return the end().
-        if (meas.empty()) {
-            return end(meas);
-        }
-
-        // Squaring the threshold to avoid doing a square-root in a tight loop.
-        auto thresholdSquared = threshold * threshold;
-        auto location = getLocation();
-
-        auto computeDistSquared = [location](LedMeasurementIterator it) {
-            auto diff = (location - it->loc);
-            return diff.dot(diff);
-        };
-
-        // Find the distance to the first point and record it as the
-        // current minimum distance;
-        auto ret = begin(meas);
-        auto minDistSq = computeDistSquared(ret);
-
-        // Search the rest of the elements to see if we can find a
-        // better one.
-        for (auto it = begin(meas), e = end(meas); it != e; ++it) {
-            auto distSq = computeDistSquared(it);
-            if (distSq < minDistSq) {
-                minDistSq = distSq;
-                ret = it;
-            }
-        }
-
-        // If the closest is within the threshold, return it.  Otherwise,
-        // return the end.
-        if (minDistSq <= thresholdSquared) {
-            return ret;
-        }
-        return end(meas);
-    }
-
     void Led::markMisidentified() {
         m_id = SENTINEL_NO_IDENTIFIER_OBJECT_OR_INSUFFICIENT_DATA;
         if (!m_brightnessHistory.empty()) {
@@ -26,6 +26,7 @@
 #define INCLUDED_LED_h_GUID_C53E1134_AD6B_46B0_4808_19C7EAA7D0EC
 
 // Internal Includes
+#include "BrightnessHistory.h"
 #include "LedIdentifier.h"
 
 // Library/third-party includes
@@ -129,18 +130,6 @@ namespace vbtracker {
         /// @brief Reports the most-recently-added position.
         cv::Point2f getLocation() const { return m_latestMeasurement.loc; }
 
-        /// @brief Find the nearest KeyPoint from a container of points to me,
-        /// if there is one within the specified threshold.  Runtime: O(n) where
-        /// n is the number of elements in keypoints.
-        /// @return end() if there is not a nearest within threshold (or an
-        /// empty container).
-        KeyPointIterator nearest(KeyPointList &keypoints,
-                                 double threshold) const;
-
-        /// @overload
-        LedMeasurementIterator nearest(LedMeasurementList &meas,
-                                       double threshold) const;
-
         /// @brief Returns the most-recent boolean "bright" state according to
         /// the LED identifier. Note that the value is only meaningful if
         /// `identified()` is true.
@@ -163,7 +152,7 @@ namespace vbtracker {
         LedMeasurement m_latestMeasurement;
 
         /// Starting from current frame going backwards
-        BrightnessList m_brightnessHistory;
+        BrightnessHistory m_brightnessHistory;
 
         /// @brief Which LED am I? Non-negative are indices, negative are
         /// sentinels
@@ -42,9 +42,9 @@ namespace vbtracker {
     /// derived classes encode the pattern-detection algorithm for specific
     /// devices.
     ///
-    /// NOTE: This class may modify the passed-in list, truncating it so that
-    /// old data points are removed once there are enough measurements to make
-    /// an estimate.
+    /// NOTE: This class may modify the passed-in history, truncating it so
+    /// that old data points are removed once there are enough measurements to
+    /// make an estimate.
     ///
     /// @todo Consider adding a distance estimator as a parameter throughout,
     /// which can be left alone for unknown or estimated based on a Kalman
@@ -55,16 +55,15 @@ namespace vbtracker {
         virtual ~LedIdentifier();
         /// @brief Determine the identity of the LED whose brightness pattern is
         /// passed in.
-        /// Truncates the passed-in list to the length needed to look for a
-        /// pattern, so it does not grow too long and waste space and time,
-        /// and perhaps produce spurious Ids.
+        /// Truncates the passed-in history to the length needed to look for a
+        /// pattern, so it does not produce spurious Ids.
         /// @param[out] lastBright set to True if we determine that the LED is
         /// currently "bright"
         /// @return -1 for unknown (not enough information) and
         /// less than -1 for definitely not an LED (light sources will be
         /// constant, mis-tracked LEDs may produce spurious changes in the
         /// pattern for example).
-        virtual int getId(int currentId, BrightnessList &brightnesses,
+        virtual int getId(int currentId, BrightnessHistory &brightnesses,
                           bool &lastBright, bool blobsKeepId) const = 0;
 
       protected:
@@ -0,0 +1,114 @@
+/** @file
+    @brief Implementation
+
+    @date 2015
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2015 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "ImageSourceFactories.h"
+
+// Library/third-party includes
+#include <opencv2/highgui/highgui.hpp> // for image decoding
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+// Standard includes
+#include <iomanip>
+#include <sstream>
+
+namespace osvr {
+namespace vbtracker {
+    namespace bip = boost::interprocess;
+
+    /// @brief Plays back a recorded image sequence once, as fast as it's
+    /// asked for frames, keeping only the current file mapped.
+    class ReplayImageSource : public ImageSource {
+      public:
+        ReplayImageSource(std::string const &imagesDir);
+        virtual ~ReplayImageSource() {}
+
+        bool ok() const override { return m_res.area() > 0; }
+        bool grab() override;
+        void retrieveColor(cv::Mat &color) override;
+        cv::Size resolution() const override { return m_res; }
+
+      private:
+        /// @brief Maps the given 1-based image number, if it exists.
+        bool m_map(int imageNum);
+
+        std::string m_dir;
+        int m_nextImage = 1;
+        bip::mapped_region m_region;
+        cv::Size m_res;
+    };
+
+    ImageSourcePtr openImageFileSequenceReplay(std::string const &dir) {
+        auto ret = ImageSourcePtr{new ReplayImageSource{dir}};
+        if (!ret->ok()) {
+            // if we couldn't load, reset the pointer right now.
+            ret.reset();
+        }
+        return ret;
+    }
+
+    ReplayImageSource::ReplayImageSource(std::string const &imagesDir)
+        : m_dir(imagesDir) {
+        // Decode the first image just to find the resolution.
+        if (m_map(1)) {
+            cv::Mat first;
+            retrieveColor(first);
+            m_res = first.size();
+        }
+    }
+
+    bool ReplayImageSource::grab() {
+        if (!ok() || !m_map(m_nextImage)) {
+            return false;
+        }
+        ++m_nextImage;
+        return true;
+    }
+
+    void ReplayImageSource::retrieveColor(cv::Mat &color) {
+        // Wraps, rather than copies, the mapped file.
+        cv::Mat encoded(1, static_cast<int>(m_region.get_size()), CV_8UC1,
+                        m_region.get_address());
+        color = cv::imdecode(encoded, CV_LOAD_IMAGE_COLOR);
+    }
+
+    bool ReplayImageSource::m_map(int imageNum) {
+        std::ostringstream fileName;
+        fileName << m_dir << "/";
+        fileName << std::setfill('0') << std::setw(4) << imageNum;
+        fileName << ".tif";
+        try {
+            bip::file_mapping file(fileName.str().c_str(), bip::read_only);
+            bip::mapped_region region(file, bip::read_only);
+            m_region.swap(region);
+        } catch (bip::interprocess_exception &) {
+            // Past the end of the sequence, most likely.
+            return false;
+        }
+        return true;
+    }
+
+} // namespace vbtracker
+} // namespace osvr
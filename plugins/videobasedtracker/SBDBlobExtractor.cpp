@@ -222,7 +222,10 @@ namespace vbtracker {
     std::vector<LedMeasurement> const &
     SBDBlobExtractor::extractBlobs(cv::Mat const &grayImage) {
         m_latestMeasurements.clear();
-        m_lastGrayImage = grayImage.clone();
+        if (m_params.debug) {
+            // Reuses the storage from last time.
+            grayImage.copyTo(m_lastGrayImage);
+        }
         m_debugThresholdImageDirty = true;
         m_debugBlobImageDirty = true;
 
@@ -256,7 +259,7 @@ namespace vbtracker {
         //================================================================
         // Tracking the points
 
-        // Construct a blob detector and find the blobs in the image.
+        // Find the blobs in the image.
         double minVal, maxVal;
         cv::minMaxIdx(grayImage, &minVal, &maxVal);
         auto &p = m_params.blobParams;
@@ -282,15 +285,7 @@ namespace vbtracker {
 /// @todo: Determine the maximum size of a trackable blob by seeing
 /// when we're so close that we can't view at least four in the
 /// camera.
-#if CV_MAJOR_VERSION == 2
-        cv::Ptr<cv::SimpleBlobDetector> detector =
-            new cv::SimpleBlobDetector(m_sbdParams);
-#elif CV_MAJOR_VERSION == 3
-        auto detector = cv::SimpleBlobDetector::create(m_sbdParams);
-#else
-#error "Unrecognized OpenCV version!"
-#endif
-        detector->detect(grayImage, m_keyPoints);
+        m_detector.detect(grayImage, m_sbdParams, m_keyPoints);
 
         // @todo: Consider computing the center of mass of a dilated bounding
         // rectangle around each keypoint to produce a more precise subpixel
@@ -304,6 +299,9 @@ namespace vbtracker {
     }
 
     cv::Mat SBDBlobExtractor::generateDebugThresholdImage() const {
+        if (m_lastGrayImage.empty()) {
+            return cv::Mat();
+        }
 
         // Fake the thresholded image to give an idea of what the
         // blob detector is doing.
@@ -334,6 +332,9 @@ namespace vbtracker {
 
     cv::Mat SBDBlobExtractor::generateDebugBlobImage() const {
         cv::Mat ret;
+        if (m_lastGrayImage.empty()) {
+            return ret;
+        }
         cv::Mat tempColor;
         cv::cvtColor(m_lastGrayImage, tempColor, CV_GRAY2BGR);
         // Draw detected blobs as blue circles.
@@ -26,8 +26,8 @@
 #define INCLUDED_SBDBlobExtractor_h_GUID_E67E1F86_F827_48A3_5FA2_F9F241BA79AF
 
 // Internal Includes
-#include "Types.h"
-#include "LED.h"
+#include "BlobExtractor.h"
+#include "BlobDetector.h"
 
 // Library/third-party includes
 #include <opencv2/features2d/features2d.hpp>
@@ -40,18 +40,18 @@ namespace osvr {
 namespace vbtracker {
     class KeypointDetailer;
 
-    /// A class performing blob-extraction duties on incoming frames.
-    class SBDBlobExtractor {
+    /// A class performing blob-extraction duties on incoming frames, using
+    /// the algorithm of OpenCV's SimpleBlobDetector.
+    class SBDBlobExtractor : public BlobExtractor {
       public:
         explicit SBDBlobExtractor(ConfigParams const &params);
-        ~SBDBlobExtractor();
+        ~SBDBlobExtractor() override;
         std::vector<LedMeasurement> const &
-        extractBlobs(cv::Mat const &grayImage);
+        extractBlobs(cv::Mat const &grayImage) override;
 
-        cv::Mat const &getDebugThresholdImage();
-
-        cv::Mat const &getDebugBlobImage();
-        cv::Mat const &getDebugExtraImage();
+        cv::Mat const &getDebugThresholdImage() override;
+        cv::Mat const &getDebugBlobImage() override;
+        cv::Mat const &getDebugExtraImage() override;
 
       private:
         void getKeypoints(cv::Mat const &grayImage);
@@ -63,6 +63,7 @@ namespace vbtracker {
         std::vector<LedMeasurement> m_latestMeasurements;
 
         std::vector<cv::KeyPoint> m_keyPoints;
+        BlobDetector m_detector;
 
         std::unique_ptr<KeypointDetailer> m_keypointDetailer;
         cv::Mat m_lastGrayImage;
@@ -0,0 +1,112 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TaskPool.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace vbtracker {
+
+    TaskPool::TaskPool(std::size_t extraThreads) {
+        for (std::size_t i = 0; i < extraThreads; ++i) {
+            m_threads.emplace_back([&] { m_workerLoop(); });
+        }
+    }
+
+    TaskPool::~TaskPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for (auto &thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    void TaskPool::run(std::size_t n, Task const &task) {
+        if (m_threads.empty() || n < 2) {
+            for (std::size_t i = 0; i < n; ++i) {
+                task(i);
+            }
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = n;
+        m_next = 0;
+        m_remaining = n;
+        m_wake.notify_all();
+        m_work(lock);
+        m_done.wait(lock, [&] { return m_remaining == 0; });
+        m_task = nullptr;
+        if (m_error) {
+            auto error = m_error;
+            m_error = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void TaskPool::m_workerLoop() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_wake.wait(lock, [&] {
+                return m_stopping || (m_task && m_next < m_count);
+            });
+            if (m_stopping) {
+                return;
+            }
+            m_work(lock);
+        }
+    }
+
+    void TaskPool::m_work(std::unique_lock<std::mutex> &lock) {
+        while (m_task && m_next < m_count) {
+            auto i = m_next++;
+            auto task = m_task;
+            lock.unlock();
+            std::exception_ptr error;
+            try {
+                (*task)(i);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+            if (error && !m_error) {
+                m_error = error;
+            }
+            if (--m_remaining == 0) {
+                m_done.notify_all();
+            }
+        }
+    }
+
+} // namespace vbtracker
+} // namespace osvr
@@ -0,0 +1,86 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_TaskPool_h_GUID_32A439BB_38A7_4233_9AED_7AB6554E5CEE
+#define INCLUDED_TaskPool_h_GUID_32A439BB_38A7_4233_9AED_7AB6554E5CEE
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace osvr {
+namespace vbtracker {
+    /// @brief A small, fixed set of worker threads for running a handful of
+    /// coarse, independent tasks (such as one per sensor) at once.
+    class TaskPool : boost::noncopyable {
+      public:
+        typedef std::function<void(std::size_t)> Task;
+
+        /// @brief Starts @p extraThreads worker threads: the thread calling
+        /// run() works too.
+        explicit TaskPool(std::size_t extraThreads);
+
+        /// @brief Stops and joins the worker threads.
+        ~TaskPool();
+
+        /// @brief Calls @p task with each index in [0, n), spread across the
+        /// workers and the calling thread, returning once all are done.
+        ///
+        /// Only one thread may call this at a time. If any call to @p task
+        /// throws, the first exception is rethrown once all have finished.
+        void run(std::size_t n, Task const &task);
+
+      private:
+        void m_workerLoop();
+
+        /// @brief Runs tasks until none are left to start. Takes and returns
+        /// with the lock held.
+        void m_work(std::unique_lock<std::mutex> &lock);
+
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_done;
+        Task const *m_task = nullptr;
+        std::size_t m_count = 0;
+        std::size_t m_next = 0;
+        std::size_t m_remaining = 0;
+        std::exception_ptr m_error;
+        bool m_stopping = false;
+        std::vector<std::thread> m_threads;
+    };
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_TaskPool_h_GUID_32A439BB_38A7_4233_9AED_7AB6554E5CEE
@@ -0,0 +1,233 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TrackingPipeline.h"
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <condition_variable>
+#include <deque>
+
+namespace osvr {
+namespace vbtracker {
+    typedef std::chrono::steady_clock clock_type;
+
+    /// @brief How many captured frames may wait for blob extraction: a
+    /// little slack for jitter.
+    static const std::size_t BLOB_QUEUE_DEPTH = 2;
+    /// @brief How many frames may wait for pose estimation: only the newest,
+    /// since that's the slow stage.
+    static const std::size_t POSE_QUEUE_DEPTH = 1;
+    /// @brief How long the blob stage waits for a frame before checking
+    /// whether it should stop.
+    static const std::chrono::milliseconds STAGE_WAIT(100);
+
+    /// @brief A bounded handoff between two stages, dropping the oldest frame
+    /// when full instead of blocking the producer.
+    class TrackingPipeline::FrameQueue {
+      public:
+        explicit FrameQueue(std::size_t capacity) : m_capacity(capacity) {}
+
+        /// @brief Adds a frame.
+        /// @return the frame dropped to make room, if any.
+        FramePtr push(FramePtr &&frame) {
+            FramePtr dropped;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_frames.size() == m_capacity) {
+                    dropped = std::move(m_frames.front());
+                    m_frames.pop_front();
+                }
+                m_frames.push_back(std::move(frame));
+            }
+            m_cv.notify_one();
+            return dropped;
+        }
+
+        /// @brief Takes the oldest frame, waiting up to @p timeout for one.
+        /// @return null if none arrived or the queue was stopped.
+        FramePtr pop(std::chrono::milliseconds timeout) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait_for(lock, timeout,
+                          [&] { return m_stopped || !m_frames.empty(); });
+            FramePtr ret;
+            if (!m_stopped && !m_frames.empty()) {
+                ret = std::move(m_frames.front());
+                m_frames.pop_front();
+            }
+            return ret;
+        }
+
+        /// @brief Wakes up and turns away anyone waiting.
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopped = true;
+            }
+            m_cv.notify_all();
+        }
+
+      private:
+        const std::size_t m_capacity;
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::deque<FramePtr> m_frames;
+        bool m_stopped = false;
+    };
+
+    void TrackingPipeline::StageCounters::finished(
+        clock_type::time_point start, OSVR_TimeValue const &captured) {
+        auto end = clock_type::now();
+        busyMicroseconds += static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+                .count());
+        auto latency =
+            util::time::duration(util::time::getNow(), captured) * 1.e6;
+        if (latency > 0) {
+            latencyMicroseconds += static_cast<std::uint64_t>(latency);
+        }
+        ++frames;
+    }
+
+    PipelineStageStats TrackingPipeline::StageCounters::get() const {
+        PipelineStageStats ret;
+        ret.frames = frames;
+        ret.dropped = dropped;
+        ret.busySeconds = busyMicroseconds / 1.e6;
+        ret.latencySeconds = latencyMicroseconds / 1.e6;
+        return ret;
+    }
+
+    TrackingPipeline::TrackingPipeline(ImageSource &source,
+                                       VideoBasedTracker &tracker)
+        : m_source(source), m_tracker(tracker), m_running(true),
+          m_blobQueue(new FrameQueue(BLOB_QUEUE_DEPTH)),
+          m_poseQueue(new FrameQueue(POSE_QUEUE_DEPTH)) {
+        m_captureThread = std::thread([&] { m_captureLoop(); });
+        m_blobThread = std::thread([&] { m_blobLoop(); });
+    }
+
+    TrackingPipeline::~TrackingPipeline() {
+        m_running = false;
+        m_blobQueue->stop();
+        m_poseQueue->stop();
+        // The capture thread may have to wait for one more frame.
+        m_captureThread.join();
+        m_blobThread.join();
+    }
+
+    bool TrackingPipeline::processNext(TimestampedPoseHandler const &handler,
+                                       std::chrono::milliseconds timeout) {
+        auto frame = m_poseQueue->pop(timeout);
+        if (!frame) {
+            return false;
+        }
+        auto start = clock_type::now();
+        auto const &timestamp = frame->timestamp;
+        m_tracker.processLeds(
+            frame->color, frame->gray, frame->leds, timestamp,
+            [&](OSVR_ChannelCount sensor, OSVR_Pose3 const &pose) {
+                handler(sensor, pose, timestamp);
+            });
+        m_poseCounters.finished(start, timestamp);
+        m_recycle(std::move(frame));
+        return true;
+    }
+
+    PipelineStageStats TrackingPipeline::getCaptureStats() const {
+        return m_captureCounters.get();
+    }
+
+    PipelineStageStats TrackingPipeline::getBlobStats() const {
+        return m_blobCounters.get();
+    }
+
+    PipelineStageStats TrackingPipeline::getPoseStats() const {
+        return m_poseCounters.get();
+    }
+
+    void TrackingPipeline::m_captureLoop() {
+        while (m_running) {
+            if (!m_source.ok() || !m_source.grab()) {
+                // Maybe the camera will be plugged back in later.
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                continue;
+            }
+            // Our best estimate of when the tracker was at the pose seen.
+            auto frame = m_getFreeFrame();
+            osvrTimeValueGetNow(&frame->timestamp);
+            auto start = clock_type::now();
+            m_source.retrieve(frame->color, frame->gray);
+            m_captureCounters.finished(start, frame->timestamp);
+            auto dropped = m_blobQueue->push(std::move(frame));
+            if (dropped) {
+                ++m_blobCounters.dropped;
+                m_recycle(std::move(dropped));
+            }
+        }
+    }
+
+    void TrackingPipeline::m_blobLoop() {
+        while (m_running) {
+            auto frame = m_blobQueue->pop(STAGE_WAIT);
+            if (!frame) {
+                continue;
+            }
+            auto start = clock_type::now();
+            m_tracker.extractLeds(frame->gray, frame->leds);
+            m_blobCounters.finished(start, frame->timestamp);
+            auto dropped = m_poseQueue->push(std::move(frame));
+            if (dropped) {
+                ++m_poseCounters.dropped;
+                m_recycle(std::move(dropped));
+            }
+        }
+    }
+
+    TrackingPipeline::FramePtr TrackingPipeline::m_getFreeFrame() {
+        {
+            std::lock_guard<std::mutex> lock(m_freeMutex);
+            if (!m_freeFrames.empty()) {
+                auto ret = std::move(m_freeFrames.back());
+                m_freeFrames.pop_back();
+                return ret;
+            }
+        }
+        return FramePtr{new Frame};
+    }
+
+    void TrackingPipeline::m_recycle(FramePtr &&frame) {
+        if (!frame) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_freeMutex);
+        m_freeFrames.push_back(std::move(frame));
+    }
+
+} // namespace vbtracker
+} // namespace osvr
@@ -0,0 +1,158 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_TrackingPipeline_h_GUID_625F3562_77C8_4D86_975F_F0035BCFF9F6
+#define INCLUDED_TrackingPipeline_h_GUID_625F3562_77C8_4D86_975F_F0035BCFF9F6
+
+// Internal Includes
+#include "Types.h"
+#include "ImageSource.h"
+#include "VideoBasedTracker.h"
+#include <osvr/Util/ChannelCountC.h>
+#include <osvr/Util/Pose3C.h>
+#include <osvr/Util/TimeValueC.h>
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace osvr {
+namespace vbtracker {
+    /// @brief A snapshot of the counters for one stage of a TrackingPipeline.
+    struct PipelineStageStats {
+        /// @brief Frames this stage has finished with.
+        std::uint64_t frames = 0;
+        /// @brief Frames dropped, unprocessed, while waiting for this stage
+        /// because a newer frame came along.
+        std::uint64_t dropped = 0;
+        /// @brief Total time spent working rather than waiting.
+        double busySeconds = 0;
+        /// @brief Total time from capture to the end of this stage.
+        double latencySeconds = 0;
+    };
+
+    /// @brief Runs the video tracker as a pipeline, so capturing a frame,
+    /// extracting its blobs, and estimating poses from them overlap with the
+    /// same work on the frames before and after it.
+    ///
+    /// Capture (including conversion to grayscale) and blob extraction each
+    /// get a thread of their own, while the pose stage runs on whatever
+    /// thread calls processNext(), so that poses can be sent from the
+    /// device's own thread. The handoff between stages is bounded: when a
+    /// stage falls behind, the oldest frames waiting for it are dropped
+    /// rather than queued, so the camera keeps its full rate and the latency
+    /// of the poses reported stays bounded. A dropped frame looks, to the LED
+    /// identification, like one the camera itself missed, so if a stage
+    /// falls behind the camera for long, the blink codes can't be read and
+    /// beacons stop being identified.
+    ///
+    /// The tracker must have all of its sensors added before the pipeline
+    /// is created, and must not be used otherwise while it exists.
+    class TrackingPipeline : boost::noncopyable {
+      public:
+        typedef std::function<void(OSVR_ChannelCount, OSVR_Pose3 const &,
+                                   OSVR_TimeValue const &)>
+            TimestampedPoseHandler;
+
+        /// @brief Starts the capture and blob extraction threads.
+        TrackingPipeline(ImageSource &source, VideoBasedTracker &tracker);
+
+        /// @brief Stops and joins the threads.
+        ~TrackingPipeline();
+
+        /// @brief Runs the pose stage on the newest frame through blob
+        /// extraction, waiting up to @p timeout for one.
+        ///
+        /// @param handler Called for each pose, with the time the frame was
+        /// captured.
+        /// @return false if no frame was ready in time.
+        bool processNext(TimestampedPoseHandler const &handler,
+                         std::chrono::milliseconds timeout);
+
+        /// @name Per-stage counters
+        /// @{
+        PipelineStageStats getCaptureStats() const;
+        PipelineStageStats getBlobStats() const;
+        PipelineStageStats getPoseStats() const;
+        /// @}
+
+      private:
+        struct Frame {
+            cv::Mat color;
+            cv::Mat gray;
+            OSVR_TimeValue timestamp;
+            LedMeasurementList leds;
+        };
+        typedef std::unique_ptr<Frame> FramePtr;
+        class FrameQueue;
+
+        struct StageCounters {
+            std::atomic<std::uint64_t> frames{0};
+            std::atomic<std::uint64_t> dropped{0};
+            std::atomic<std::uint64_t> busyMicroseconds{0};
+            std::atomic<std::uint64_t> latencyMicroseconds{0};
+            void finished(std::chrono::steady_clock::time_point start,
+                          OSVR_TimeValue const &captured);
+            PipelineStageStats get() const;
+        };
+
+        void m_captureLoop();
+        void m_blobLoop();
+
+        /// @brief Gets a frame whose buffers can be reused, or a new one.
+        FramePtr m_getFreeFrame();
+        /// @brief Returns a frame (if not null) for reuse.
+        void m_recycle(FramePtr &&frame);
+
+        ImageSource &m_source;
+        VideoBasedTracker &m_tracker;
+        std::atomic<bool> m_running;
+
+        std::mutex m_freeMutex;
+        std::vector<FramePtr> m_freeFrames;
+
+        std::unique_ptr<FrameQueue> m_blobQueue;
+        std::unique_ptr<FrameQueue> m_poseQueue;
+
+        StageCounters m_captureCounters;
+        StageCounters m_blobCounters;
+        StageCounters m_poseCounters;
+
+        std::thread m_captureThread;
+        std::thread m_blobThread;
+    };
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_TrackingPipeline_h_GUID_625F3562_77C8_4D86_975F_F0035BCFF9F6
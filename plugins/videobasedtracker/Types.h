@@ -33,7 +33,6 @@
 
 // Standard includes
 #include <vector>
-#include <list>
 #include <string>
 #include <memory>
 #include <functional>
@@ -42,6 +41,7 @@ namespace osvr {
 namespace vbtracker {
     class Led;
     class LedIdentifier;
+    class BrightnessHistory;
     class BeaconBasedPoseEstimator;
 
     typedef std::vector<cv::Point3f> Point3Vector;
@@ -53,10 +53,6 @@ namespace vbtracker {
 
     typedef std::vector<std::string> PatternStringList;
 
-    typedef std::string LedPatternWrapped; //< Pattern repeated almost twice
-    typedef std::vector<LedPatternWrapped>
-        PatternList; //< Ordered set of patterns to search
-
     typedef std::vector<cv::KeyPoint> KeyPointList;
     typedef KeyPointList::iterator KeyPointIterator;
 
@@ -65,13 +61,13 @@ namespace vbtracker {
     typedef LedMeasurementList::iterator LedMeasurementIterator;
 
     typedef float Brightness;
-    typedef std::list<Brightness> BrightnessList;
     typedef std::pair<Brightness, Brightness> BrightnessMinMax;
 
     typedef std::unique_ptr<BeaconBasedPoseEstimator> EstimatorPtr;
     typedef std::unique_ptr<LedIdentifier> LedIdentifierPtr;
 
-    typedef std::list<Led> LedGroup;
+    /// Contiguous, since it's walked (and compacted) every frame.
+    typedef std::vector<Led> LedGroup;
 
     /// @name Containers of "per-sensor" objects
     /// @brief It seems like in a "well-formed" video-based tracker, there is
@@ -88,8 +84,21 @@ namespace vbtracker {
     /// should be considered fixed - not subject to autocalibration)
     using BeaconIDPredicate = std::function<bool(int)>;
 
+    /// Which blob extraction algorithm to use.
+    enum class BlobExtractorType {
+        /// The algorithm of OpenCV's SimpleBlobDetector: contours and shape
+        /// filters at several thresholds, combined. Config value "simple".
+        SimpleBlobDetector,
+        /// A single threshold and a single pass of connected-component
+        /// labeling, with intensity-weighted centroids: much faster, but
+        /// only the minArea filter applies. Config value "bright".
+        BrightBlob
+    };
+
     /// Blob detection configuration parameters
     struct BlobParams {
+        /// Which blob extraction algorithm to use.
+        BlobExtractorType extractor = BlobExtractorType::SimpleBlobDetector;
         /// Same meaning as the parameter to OpenCV's SimpleBlobDetector - in
         /// pixel units
         float minDistBetweenBlobs = 3.0f;
@@ -155,6 +164,21 @@ namespace vbtracker {
         /// decide (that is, not set an explicit preference)
         int numThreads = 1;
 
+        /// Whether to run capture, blob extraction, and pose estimation as a
+        /// pipeline on separate threads, dropping stale frames if pose
+        /// estimation falls behind. Off by default (opt in through the
+        /// config), since it only helps where each stage keeps up with the
+        /// camera (see TrackingPipeline); ignored (everything runs serially)
+        /// when debug is set.
+        bool pipelined = false;
+
+        /// How many threads may estimate the poses of different sensors (for
+        /// instance, an HMD and controllers seen by the same camera) at once,
+        /// including the tracker's own. The default, 1, processes sensors in
+        /// turn; set to 0 or less for one per sensor, up to the number of
+        /// hardware threads.
+        int poseEstimationThreads = 1;
+
         /// This is the autocorrelation kernel of the process noise. The first
         /// three elements correspond to position, the second three to
         /// incremental rotation.
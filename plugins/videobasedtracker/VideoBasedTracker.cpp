@@ -28,6 +28,7 @@
 #include "CameraDistortionModel.h"
 #include <osvr/Util/EigenCoreGeometry.h>
 #include <osvr/Util/CSV.h>
+#include <osvr/Common/Tracing.h>
 
 // Library/third-party includes
 #include <opencv2/core/version.hpp>
@@ -38,12 +39,13 @@
 #include <fstream>
 #include <algorithm>
 #include <iostream>
+#include <thread>
 
 namespace osvr {
 namespace vbtracker {
 
     VideoBasedTracker::VideoBasedTracker(ConfigParams const &params)
-        : m_params(params), m_blobExtractor(params) {}
+        : m_params(params), m_blobExtractor(makeBlobExtractor(params)) {}
 
     // This version requires YOU to add your beacons! You!
     void VideoBasedTracker::addSensor(
@@ -56,6 +58,8 @@ namespace vbtracker {
             camParams.createUndistortedVariant(), requiredInliers,
             permittedOutliers, m_params));
         m_led_groups.emplace_back();
+        m_sensorClaims.emplace_back();
+        m_sensorResults.emplace_back();
         beaconAdder(*m_estimators.back());
         m_assertInvariants();
     }
@@ -128,11 +132,12 @@ namespace vbtracker {
         m_debugFrame++;
     }
 
-    /// Perform the undistortion of LED measurements.
-    inline std::vector<LedMeasurement>
+    /// Perform the undistortion of LED measurements, into @p ret (reusing its
+    /// storage).
+    inline void
     undistortLeds(std::vector<LedMeasurement> const &distortedMeasurements,
-                  CameraParameters const &camParams) {
-        std::vector<LedMeasurement> ret;
+                  CameraParameters const &camParams,
+                  std::vector<LedMeasurement> &ret) {
         ret.resize(distortedMeasurements.size());
         auto distortionModel = CameraDistortionModel{
             Eigen::Vector2d{camParams.focalLengthX(), camParams.focalLengthY()},
@@ -147,85 +152,78 @@ namespace vbtracker {
         };
         std::transform(begin(distortedMeasurements), end(distortedMeasurements),
                        begin(ret), ledUndistort);
-        return ret;
     }
 
     bool VideoBasedTracker::processImage(cv::Mat frame, cv::Mat grayImage,
                                          OSVR_TimeValue const &tv,
                                          PoseHandler handler) {
+        common::tracing::VideoTrackerStage traceFrame("VideoTracker Frame");
+        extractLeds(grayImage, m_undistortedLeds);
+        return processLeds(frame, grayImage, m_undistortedLeds, tv, handler);
+    }
+
+    void VideoBasedTracker::extractLeds(cv::Mat const &grayImage,
+                                        LedMeasurementList &undistortedLeds) {
+        common::tracing::VideoTrackerStage trace("VideoTracker BlobExtraction");
+        auto const &foundLeds = m_blobExtractor->extractBlobs(grayImage);
+
+        /// Perform the undistortion of keypoints
+        undistortLeds(foundLeds, m_camParams, undistortedLeds);
+    }
+
+    bool
+    VideoBasedTracker::processLeds(cv::Mat frame, cv::Mat grayImage,
+                                   LedMeasurementList const &undistortedLeds,
+                                   OSVR_TimeValue const &tv,
+                                   PoseHandler handler) {
         m_assertInvariants();
         bool done = false;
         m_frame = frame;
         m_imageGray = grayImage;
-        auto foundLeds = m_blobExtractor.extractBlobs(grayImage);
-
-        /// Perform the undistortion of keypoints
-        auto undistortedLeds = undistortLeds(foundLeds, m_camParams);
+        {
+            common::tracing::VideoTrackerStage trace(
+                "VideoTracker BlobIndexing");
+            // Size grid cells to a typical association search radius.
+            float meanDiameter = 0.f;
+            for (auto const &meas : undistortedLeds) {
+                meanDiameter += meas.diameter;
+            }
+            if (!undistortedLeds.empty()) {
+                meanDiameter /= undistortedLeds.size();
+            }
+            m_blobGrid.build(undistortedLeds,
+                             static_cast<float>(m_params.blobMoveThreshold *
+                                                meanDiameter));
+        }
 
         // We allow multiple sets of LEDs, each corresponding to a different
         // sensor, to be located in the same image.  We construct a new set
         // of LEDs for each and try to find them.  It is assumed that they all
         // have unique ID patterns across all sensors.
-        for (size_t sensor = 0; sensor < m_identifiers.size(); sensor++) {
+        //
+        // Each sensor only reads the shared blob index, so they are processed
+        // concurrently, then reported in order.
+        auto numSensors = m_identifiers.size();
+        if (!m_sensorPool) {
+            auto threads = static_cast<std::size_t>(
+                std::max(m_params.poseEstimationThreads, 0));
+            if (threads == 0) {
+                threads = std::max(std::thread::hardware_concurrency(), 1u);
+            }
+            threads = std::max<std::size_t>(std::min(threads, numSensors), 1);
+            m_sensorPool.reset(new TaskPool(threads - 1));
+        }
+        m_sensorPool->run(numSensors, [&](std::size_t sensor) {
+            m_processSensor(sensor, undistortedLeds, tv);
+        });
 
+        for (size_t sensor = 0; sensor < numSensors; sensor++) {
             osvrPose3SetIdentity(&m_pose);
-            auto ledsMeasurements = undistortedLeds;
-
-            // Locate the closest blob from this frame to each LED found
-            // in the previous frame.  If it is close enough to the nearest
-            // neighbor from last time, we assume that it is the same LED and
-            // update it.  If not, we delete the LED from the list.  Once we
-            // have matched a blob to an LED, we remove it from the list.  If
-            // there are any blobs leftover, we create new LEDs from them.
-            // @todo: Include motion estimate based on Kalman filter along with
-            // model of the projection once we have one built.  Note that this
-            // will require handling the lens distortion appropriately.
-            {
-                auto &myLeds = m_led_groups[sensor];
-                auto led = begin(myLeds);
-                auto e = end(myLeds);
-                while (led != end(myLeds)) {
-                    led->resetUsed();
-                    auto threshold = m_params.blobMoveThreshold *
-                                     led->getMeasurement().diameter;
-                    auto nearest = led->nearest(ledsMeasurements, threshold);
-                    if (nearest == end(ledsMeasurements)) {
-                        // We have no blob corresponding to this LED, so we need
-                        // to delete this LED.
-                        led = myLeds.erase(led);
-                    } else {
-                        // Update the values in this LED and then go on to the
-                        // next one. Remove this blob from the list of
-                        // potential matches.
-                        led->addMeasurement(*nearest,
-                                            m_params.blobsKeepIdentity);
-                        ledsMeasurements.erase(nearest);
-                        ++led;
-                    }
-                }
-                // If we have any blobs that have not been associated with an
-                // LED, then we add a new LED for each of them.
-                // std::cout << "Had " << Leds.size() << " LEDs, " <<
-                // keyPoints.size() << " new ones available" << std::endl;
-                for (auto &remainingLed : ledsMeasurements) {
-                    myLeds.emplace_back(m_identifiers[sensor].get(),
-                                        remainingLed);
-                }
-            }
-            //==================================================================
-            // Compute the pose of the HMD w.r.t. the camera frame of
-            // reference.
-            bool gotPose = false;
-            if (m_estimators[sensor]) {
-
-                // Get an estimated pose, if we have enough data.
-                OSVR_PoseState pose;
-                if (m_estimators[sensor]->EstimatePoseFromLeds(
-                        m_led_groups[sensor], tv, pose)) {
-                    m_pose = pose;
-                    handler(static_cast<unsigned>(sensor), pose);
-                    gotPose = true;
-                }
+            auto const &result = m_sensorResults[sensor];
+            bool gotPose = result.gotPose;
+            if (gotPose) {
+                m_pose = result.pose;
+                handler(static_cast<unsigned>(sensor), result.pose);
             }
             if (m_params.debug) {
                 // Don't display the debugging info every frame, or we can't go
@@ -237,10 +235,11 @@ namespace vbtracker {
                 if (++count == 11) {
                     // Fake the thresholded image to give an idea of what the
                     // blob detector is doing.
-                    m_thresholdImage = m_blobExtractor.getDebugThresholdImage();
+                    m_thresholdImage =
+                        m_blobExtractor->getDebugThresholdImage();
 
                     // Draw detected blobs as blue circles.
-                    m_imageWithBlobs = m_blobExtractor.getDebugBlobImage();
+                    m_imageWithBlobs = m_blobExtractor->getDebugBlobImage();
 
                     // Draw the unidentified (flying?) blobs (UFBs?) on the
                     // status image
@@ -397,6 +396,76 @@ namespace vbtracker {
         return done;
     }
 
+    void VideoBasedTracker::m_processSensor(
+        std::size_t sensor, LedMeasurementList const &undistortedLeds,
+        OSVR_TimeValue const &tv) {
+        auto &claims = m_sensorClaims[sensor];
+        claims.reset(undistortedLeds.size());
+        auto &result = m_sensorResults[sensor];
+        result.gotPose = false;
+
+        // Locate the closest blob from this frame to each LED found
+        // in the previous frame.  If it is close enough to the nearest
+        // neighbor from last time, we assume that it is the same LED and
+        // update it.  If not, we delete the LED from the list.  Once we
+        // have matched a blob to an LED, we claim it so no other LED can
+        // match it.  If there are any blobs leftover, we create new LEDs
+        // from them.
+        // @todo: Include motion estimate based on Kalman filter along with
+        // model of the projection once we have one built.  Note that this
+        // will require handling the lens distortion appropriately.
+        {
+            common::tracing::VideoTrackerStage trace(
+                "VideoTracker LedAssociation");
+            auto &myLeds = m_led_groups[sensor];
+            // Matched LEDs are compacted toward the front, in order, so
+            // unmatched ones can be dropped without erasing one by one.
+            auto kept = begin(myLeds);
+            for (auto led = begin(myLeds), e = end(myLeds); led != e; ++led) {
+                led->resetUsed();
+                auto threshold = m_params.blobMoveThreshold *
+                                 led->getMeasurement().diameter;
+                auto nearest =
+                    m_blobGrid.nearest(led->getLocation(), threshold, claims);
+                if (nearest == BlobGrid::NOT_FOUND) {
+                    // We have no blob corresponding to this LED, so we need
+                    // to delete this LED.
+                    continue;
+                }
+                // Update the values in this LED and then go on to the
+                // next one. Claim this blob so it's no longer a potential
+                // match.
+                led->addMeasurement(undistortedLeds[nearest],
+                                    m_params.blobsKeepIdentity);
+                claims.claim(nearest);
+                if (kept != led) {
+                    *kept = std::move(*led);
+                }
+                ++kept;
+            }
+            myLeds.erase(kept, end(myLeds));
+            // If we have any blobs that have not been associated with an
+            // LED, then we add a new LED for each of them.
+            for (std::size_t i = 0; i < undistortedLeds.size(); ++i) {
+                if (!claims.claimed(i)) {
+                    myLeds.emplace_back(m_identifiers[sensor].get(),
+                                        undistortedLeds[i]);
+                }
+            }
+        }
+        //==================================================================
+        // Compute the pose of the HMD w.r.t. the camera frame of
+        // reference.
+        if (m_estimators[sensor]) {
+            common::tracing::VideoTrackerStage trace(
+                "VideoTracker PoseEstimation");
+
+            // Get an estimated pose, if we have enough data.
+            result.gotPose = m_estimators[sensor]->EstimatePoseFromLeds(
+                m_led_groups[sensor], tv, result.pose);
+        }
+    }
+
     void VideoBasedTracker::drawLedCircleOnStatusImage(Led const &led,
                                                        bool filled,
                                                        cv::Vec3b color) {
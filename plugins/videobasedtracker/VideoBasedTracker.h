@@ -27,11 +27,13 @@
 
 // Internal Includes
 #include "Types.h"
+#include "BlobGrid.h"
 #include "LED.h"
 #include "LedIdentifier.h"
 #include "BeaconBasedPoseEstimator.h"
 #include "CameraParameters.h"
-#include "SBDBlobExtractor.h"
+#include "BlobExtractor.h"
+#include "TaskPool.h"
 #include <osvr/Util/ChannelCountC.h>
 
 // Library/third-party includes
@@ -43,6 +45,7 @@
 #include <list>
 #include <functional>
 #include <algorithm>
+#include <memory>
 
 // Define the constant below to provide debugging (window showing video and
 // behavior, printing tracked positions)
@@ -134,6 +137,25 @@ namespace vbtracker {
         bool processImage(cv::Mat frame, cv::Mat grayImage,
                           OSVR_TimeValue const &tv, PoseHandler handler);
 
+        /// @name Pipelined processing
+        /// @brief processImage() split in two steps that may run on different
+        /// threads, provided each step is only ever called from one thread
+        /// at a time and all sensors were added beforehand. Since the
+        /// debug display needs both steps' data for the same frame, it must
+        /// be off.
+        /// @{
+        /// @brief Finds the blobs in an image, undistorted, replacing the
+        /// contents of @p undistortedLeds.
+        void extractLeds(cv::Mat const &grayImage,
+                         LedMeasurementList &undistortedLeds);
+
+        /// @brief Tracks the blobs extracted from a frame into poses.
+        /// @return as processImage()
+        bool processLeds(cv::Mat frame, cv::Mat grayImage,
+                         LedMeasurementList const &undistortedLeds,
+                         OSVR_TimeValue const &tv, PoseHandler handler);
+        /// @}
+
         /// For debug purposes
         BeaconBasedPoseEstimator const &getFirstEstimator() const {
             return *(m_estimators.front());
@@ -144,6 +166,14 @@ namespace vbtracker {
             return *(m_estimators.front());
         }
 
+        /// For debug purposes
+        std::size_t getNumSensors() const { return m_identifiers.size(); }
+
+        /// For debug purposes: the LEDs currently tracked for a sensor.
+        LedGroup const &getLedGroup(std::size_t sensor) const {
+            return m_led_groups[sensor];
+        }
+
       private:
         /// @overload
         /// For advanced usage - this one requires YOU to add your beacons by
@@ -153,6 +183,13 @@ namespace vbtracker {
             std::function<void(BeaconBasedPoseEstimator &)> const &beaconAdder,
             size_t requiredInliers = 4, size_t permittedOutliers = 2);
 
+        /// @brief Associates a frame's blobs with one sensor's LEDs and
+        /// estimates that sensor's pose into m_sensorResults. Touches no
+        /// other sensor's state, so sensors may be processed concurrently.
+        void m_processSensor(std::size_t sensor,
+                             LedMeasurementList const &undistortedLeds,
+                             OSVR_TimeValue const &tv);
+
         void dumpKeypointDebugData(std::vector<cv::KeyPoint> const &keypoints);
 
         void drawLedCircleOnStatusImage(Led const &led, bool filled,
@@ -172,7 +209,12 @@ namespace vbtracker {
         /// @}
 
         ConfigParams m_params;
-        SBDBlobExtractor m_blobExtractor;
+        BlobExtractorPtr m_blobExtractor;
+        /// The current frame's blobs, undistorted: a member so its storage
+        /// can be reused from frame to frame.
+        LedMeasurementList m_undistortedLeds;
+        /// Index of the current frame's blobs, shared by all sensors.
+        BlobGrid m_blobGrid;
         cv::SimpleBlobDetector::Params m_sbdParams;
 
         /// @brief Test (with asserts) what Ryan thinks are the invariants. Will
@@ -198,6 +240,21 @@ namespace vbtracker {
         EstimatorList m_estimators;
         /// @}
 
+        /// @brief What m_processSensor() found for one sensor in the current
+        /// frame.
+        struct SensorResult {
+            bool gotPose = false;
+            OSVR_PoseState pose;
+        };
+        /// @name Per-sensor scratch for the current frame
+        /// @{
+        std::vector<BlobClaims> m_sensorClaims;
+        std::vector<SensorResult> m_sensorResults;
+        /// @}
+        /// Runs m_processSensor() for several sensors at once: created on the
+        /// first frame, once all sensors have been added.
+        std::unique_ptr<TaskPool> m_sensorPool;
+
         /// @brief The pose that we report
         OSVR_PoseState m_pose;
 
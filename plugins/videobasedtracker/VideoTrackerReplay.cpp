@@ -0,0 +1,461 @@
+/** @file
+    @brief Implementation of a headless runner that replays a recorded image
+    sequence through the tracker and reports its performance.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "VideoBasedTracker.h"
+#include "HDKLedIdentifierFactory.h"
+#include "CameraParameters.h"
+#include "HDKData.h"
+#include "ImageSourceFactories.h"
+#include <osvr/Util/EigenInterop.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace osvr::vbtracker;
+typedef std::chrono::steady_clock clock_type;
+
+/// @brief Timestamps are spaced as if from the HDK camera, however fast the
+/// frames are actually replayed, so the filters behave as they would live.
+static const double FRAME_PERIOD = 0.01;
+
+/// @brief Upper edges, in milliseconds, of the latency histogram buckets: the
+/// last bucket is unbounded.
+static const double BUCKET_EDGES[] = {0.25, 0.5, 1, 2, 4, 8, 16, 32, 64};
+static const std::size_t NUM_BUCKETS =
+    sizeof(BUCKET_EDGES) / sizeof(BUCKET_EDGES[0]) + 1;
+
+/// @brief Durations of one stage of processing, one per frame.
+class StageTimes {
+  public:
+    explicit StageTimes(std::string const &name) : m_name(name) {}
+
+    void add(clock_type::duration d) {
+        m_ms.push_back(std::chrono::duration<double, std::milli>(d).count());
+    }
+
+    void report() const {
+        std::cout << m_name << ":";
+        if (m_ms.empty()) {
+            std::cout << " no samples" << std::endl;
+            return;
+        }
+        auto sorted = m_ms;
+        std::sort(begin(sorted), end(sorted));
+        double sum = 0;
+        for (auto ms : sorted) {
+            sum += ms;
+        }
+        auto percentile = [&](double p) {
+            return sorted[static_cast<std::size_t>(p * (sorted.size() - 1))];
+        };
+        std::cout << " mean " << sum / sorted.size() << " ms, median "
+                  << percentile(0.5) << " ms, 95th percentile "
+                  << percentile(0.95) << " ms, max " << sorted.back()
+                  << " ms" << std::endl;
+
+        std::size_t counts[NUM_BUCKETS] = {};
+        for (auto ms : sorted) {
+            auto bucket = std::upper_bound(std::begin(BUCKET_EDGES),
+                                           std::end(BUCKET_EDGES), ms) -
+                          std::begin(BUCKET_EDGES);
+            counts[bucket]++;
+        }
+        auto mostCounts = *std::max_element(std::begin(counts),
+                                            std::end(counts));
+        for (std::size_t i = 0; i < NUM_BUCKETS; ++i) {
+            std::cout << "  ";
+            if (i + 1 < NUM_BUCKETS) {
+                std::cout << "<" << std::setw(5) << BUCKET_EDGES[i];
+            } else {
+                std::cout << ">=" << std::setw(4) << BUCKET_EDGES[i - 1];
+            }
+            std::cout << " ms " << std::setw(6) << counts[i] << " "
+                      << std::string(counts[i] * 40 / mostCounts, '#')
+                      << std::endl;
+        }
+    }
+
+  private:
+    std::string m_name;
+    std::vector<double> m_ms;
+};
+
+/// @brief Per-sensor tracking quality.
+///
+/// Jitter is measured as the frame-to-frame change in velocity (the second
+/// difference of the poses), which is small for smooth motion, recorded or
+/// not, but large for noise.
+class SensorStats {
+  public:
+    void addFrame(LedGroup const &leds) {
+        ++m_frames;
+        for (auto const &led : leds) {
+            if (led.identified()) {
+                ++m_identified;
+            }
+            if (led.wasUsedLastFrame()) {
+                ++m_used;
+            }
+        }
+    }
+
+    /// @brief The sequence is starting over, so the next pose doesn't
+    /// follow from the last.
+    void restart() { m_havePrev = false; }
+
+    void addPose(std::size_t frame, OSVR_Pose3 const &pose) {
+        ++m_poses;
+        Eigen::Vector3d pos = osvr::util::vecMap(pose.translation);
+        auto rot = osvr::util::fromQuat(pose.rotation);
+        if (m_havePrev && frame == m_prevFrame + 1) {
+            Eigen::Vector3d vel = pos - m_prevPos;
+            Eigen::Quaterniond angVel = rot * m_prevRot.inverse();
+            if (m_haveVel) {
+                auto accel = (vel - m_prevVel).norm();
+                auto angAccel =
+                    Eigen::AngleAxisd(angVel * m_prevAngVel.inverse()).angle();
+                // Take the short way around.
+                angAccel = std::min(angAccel, 2 * M_PI - angAccel);
+                m_sumSqAccel += accel * accel;
+                m_sumSqAngAccel += angAccel * angAccel;
+                ++m_jitterSamples;
+            }
+            m_prevVel = vel;
+            m_prevAngVel = angVel;
+            m_haveVel = true;
+        } else {
+            m_haveVel = false;
+        }
+        m_prevPos = pos;
+        m_prevRot = rot;
+        m_prevFrame = frame;
+        m_havePrev = true;
+    }
+
+    std::size_t poses() const { return m_poses; }
+
+    /// @brief Fraction of frames in which a pose was found.
+    double poseFraction() const {
+        return m_frames ? double(m_poses) / m_frames : 0.;
+    }
+
+    /// @brief Mean number of beacons identified per frame.
+    double identifiedPerFrame() const {
+        return m_frames ? double(m_identified) / m_frames : 0.;
+    }
+
+    void report(std::size_t sensor) const {
+        std::cout << "Sensor " << sensor << ": pose in " << m_poses << " of "
+                  << m_frames << " frames";
+        if (m_frames) {
+            std::cout << ", mean " << double(m_identified) / m_frames
+                      << " beacons identified and " << double(m_used) / m_frames
+                      << " used per frame";
+        }
+        std::cout << std::endl;
+        if (m_jitterSamples) {
+            std::cout << "  RMS jitter: "
+                      << std::sqrt(m_sumSqAccel / m_jitterSamples) * 1000.
+                      << " mm, "
+                      << std::sqrt(m_sumSqAngAccel / m_jitterSamples) * 180. /
+                             M_PI
+                      << " degrees (from " << m_jitterSamples
+                      << " runs of three consecutive poses)" << std::endl;
+        }
+    }
+
+  private:
+    std::size_t m_frames = 0;
+    std::size_t m_poses = 0;
+    std::size_t m_identified = 0;
+    std::size_t m_used = 0;
+
+    bool m_havePrev = false;
+    bool m_haveVel = false;
+    std::size_t m_prevFrame = 0;
+    Eigen::Vector3d m_prevPos;
+    Eigen::Quaterniond m_prevRot;
+    Eigen::Vector3d m_prevVel;
+    Eigen::Quaterniond m_prevAngVel;
+    double m_sumSqAccel = 0;
+    double m_sumSqAngAccel = 0;
+    std::size_t m_jitterSamples = 0;
+};
+
+/// @brief The expected position of one sensor, as an axis-aligned box since
+/// the recorded motion only varies along some axes.
+class PositionReference {
+  public:
+    PositionReference()
+        : m_min(Eigen::Vector3d::Zero()), m_max(Eigen::Vector3d::Zero()) {}
+
+    bool parse(std::string const &minText, std::string const &maxText) {
+        return parseVec(minText, m_min) && parseVec(maxText, m_max) &&
+               (m_min.array() <= m_max.array()).all();
+    }
+
+    /// @brief Distance from the position to the nearest point of the box.
+    double error(Eigen::Vector3d const &pos) const {
+        return (pos - pos.cwiseMax(m_min).cwiseMin(m_max)).norm();
+    }
+
+  private:
+    static bool parseVec(std::string const &text, Eigen::Vector3d &vec) {
+        char comma1 = 0;
+        char comma2 = 0;
+        std::istringstream is(text);
+        is >> vec[0] >> comma1 >> vec[1] >> comma2 >> vec[2];
+        return !is.fail() && comma1 == ',' && comma2 == ',';
+    }
+    Eigen::Vector3d m_min;
+    Eigen::Vector3d m_max;
+};
+
+/// @brief Thresholds that make the replay a pass/fail test, all checked
+/// against a single sensor.
+struct ReplayChecks {
+    std::size_t sensor = 0;
+    /// @brief Minimum fraction of frames with a pose.
+    double minPoseFraction = 0;
+    /// @brief Minimum mean number of beacons identified per frame.
+    double minIdentified = 0;
+    bool haveReference = false;
+    PositionReference reference;
+    /// @brief Maximum RMS distance of the poses from the reference.
+    double maxRmsError = 0;
+};
+
+static void printUsage() {
+    std::cerr
+        << "Usage: vbtracker-replay [directory [passes]] [options]\n"
+           "Options, which make the replay fail if not met:\n"
+           "  --sensor N                sensor checked (default 0)\n"
+           "  --min-pose-fraction F     fraction of frames with a pose\n"
+           "  --min-identified N        mean beacons identified per frame\n"
+           "  --reference MIN MAX       box of expected positions, as x,y,z\n"
+           "  --max-rms-error METERS    RMS distance of poses from the "
+           "reference\n";
+}
+
+/// @brief Parses the arguments.
+/// @return false on a usage error.
+static bool parseArgs(int argc, char *argv[], std::string &dir, int &passes,
+                      ReplayChecks &checks) {
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto remaining = argc - i - 1;
+        if (arg == "--sensor" && remaining >= 1) {
+            checks.sensor = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--min-pose-fraction" && remaining >= 1) {
+            checks.minPoseFraction = std::atof(argv[++i]);
+        } else if (arg == "--min-identified" && remaining >= 1) {
+            checks.minIdentified = std::atof(argv[++i]);
+        } else if (arg == "--reference" && remaining >= 2) {
+            if (!checks.reference.parse(argv[i + 1], argv[i + 2])) {
+                return false;
+            }
+            checks.haveReference = true;
+            i += 2;
+        } else if (arg == "--max-rms-error" && remaining >= 1) {
+            checks.maxRmsError = std::atof(argv[++i]);
+        } else if (arg.compare(0, 2, "--") == 0) {
+            return false;
+        } else if (positional == 0) {
+            dir = arg;
+            ++positional;
+        } else if (positional == 1) {
+            passes = std::max(std::atoi(arg.c_str()), 1);
+            ++positional;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    std::string dir = VBTRACKER_SIMULATED_IMAGES_DIR;
+    int passes = 1;
+    ReplayChecks checks;
+    if (!parseArgs(argc, argv, dir, passes, checks)) {
+        printUsage();
+        return 1;
+    }
+    std::cout << "Replaying " << dir << " " << passes << " time(s)"
+              << std::endl;
+
+    // Set up just like the plugin does for simulated images.
+    VideoBasedTracker tracker;
+    auto camParams = getSimulatedHDKCameraParameters();
+    tracker.addSensor(createHDKLedIdentifierSimulated(0), camParams,
+                      OsvrHdkLedLocations_SENSOR0,
+                      OsvrHdkLedDirections_SENSOR0,
+                      [](int id) {
+                          return (id == 16) || (id == 17) || (id == 19) ||
+                                 (id == 20);
+                      },
+                      4, 2);
+    tracker.addSensor(createHDKLedIdentifierSimulated(1), camParams,
+                      OsvrHdkLedLocations_SENSOR1,
+                      OsvrHdkLedDirections_SENSOR1, [](int) { return true; },
+                      4, 0);
+
+    StageTimes captureTimes("Capture (decode and convert)");
+    StageTimes blobTimes("Blob extraction");
+    StageTimes poseTimes("Association and pose estimation");
+    StageTimes frameTimes("Whole frame");
+    std::vector<SensorStats> sensorStats(tracker.getNumSensors());
+    if (checks.sensor >= sensorStats.size()) {
+        std::cerr << "No sensor " << checks.sensor << " to check" << std::endl;
+        return 1;
+    }
+    double sumSqError = 0;
+    double maxError = 0;
+
+    cv::Mat frame;
+    cv::Mat gray;
+    LedMeasurementList leds;
+    auto startTime = osvr::util::time::getNow();
+    std::size_t frameNum = 0;
+    auto replayStart = clock_type::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        auto source = openImageFileSequenceReplay(dir);
+        if (!source) {
+            std::cerr << "Could not open the image sequence in " << dir
+                      << std::endl;
+            return 1;
+        }
+        for (auto &stats : sensorStats) {
+            stats.restart();
+        }
+        while (true) {
+            auto start = clock_type::now();
+            if (!source->grab()) {
+                break;
+            }
+            source->retrieve(frame, gray);
+            auto captured = clock_type::now();
+            tracker.extractLeds(gray, leds);
+            auto extracted = clock_type::now();
+            auto offset =
+                static_cast<std::int64_t>(frameNum * FRAME_PERIOD * 1.e6);
+            OSVR_TimeValue tv = startTime;
+            tv.seconds += offset / 1000000;
+            tv.microseconds += static_cast<OSVR_TimeValue_Microseconds>(
+                offset % 1000000);
+            osvrTimeValueNormalize(&tv);
+            tracker.processLeds(
+                frame, gray, leds, tv,
+                [&](OSVR_ChannelCount sensor, OSVR_Pose3 const &pose) {
+                    sensorStats[sensor].addPose(frameNum, pose);
+                    if (checks.haveReference && sensor == checks.sensor) {
+                        auto err = checks.reference.error(
+                            osvr::util::vecMap(pose.translation));
+                        sumSqError += err * err;
+                        maxError = std::max(maxError, err);
+                    }
+                });
+            auto done = clock_type::now();
+
+            captureTimes.add(captured - start);
+            blobTimes.add(extracted - captured);
+            poseTimes.add(done - extracted);
+            frameTimes.add(done - start);
+            for (std::size_t i = 0; i < sensorStats.size(); ++i) {
+                sensorStats[i].addFrame(tracker.getLedGroup(i));
+            }
+            ++frameNum;
+        }
+    }
+    auto elapsed = std::chrono::duration<double>(clock_type::now() -
+                                                 replayStart)
+                       .count();
+
+    if (frameNum == 0) {
+        std::cerr << "No frames replayed from " << dir << std::endl;
+        return 1;
+    }
+    std::cout << frameNum << " frames at " << frame.cols << "x" << frame.rows
+              << " in " << elapsed << " s: " << frameNum / elapsed
+              << " frames/s" << std::endl;
+    std::cout << std::endl;
+    for (auto const *times :
+         {&captureTimes, &blobTimes, &poseTimes, &frameTimes}) {
+        times->report();
+    }
+    std::cout << std::endl;
+    for (std::size_t i = 0; i < sensorStats.size(); ++i) {
+        sensorStats[i].report(i);
+    }
+
+    auto const &checked = sensorStats[checks.sensor];
+    bool passed = true;
+    auto fail = [&](std::string const &what) {
+        std::cerr << "FAILED: sensor " << checks.sensor << " " << what
+                  << std::endl;
+        passed = false;
+    };
+    if (checked.poseFraction() < checks.minPoseFraction) {
+        fail("had a pose in a fraction " +
+             std::to_string(checked.poseFraction()) + " of frames, below " +
+             std::to_string(checks.minPoseFraction));
+    }
+    if (checked.identifiedPerFrame() < checks.minIdentified) {
+        fail("identified " + std::to_string(checked.identifiedPerFrame()) +
+             " beacons per frame, below " +
+             std::to_string(checks.minIdentified));
+    }
+    if (checks.haveReference) {
+        auto rmsError =
+            checked.poses() ? std::sqrt(sumSqError / checked.poses()) : 0.;
+        std::cout << "Sensor " << checks.sensor
+                  << " position error from reference: RMS "
+                  << rmsError * 1000. << " mm, max " << maxError * 1000.
+                  << " mm" << std::endl;
+        if (checked.poses() == 0) {
+            fail("had no poses to compare with the reference");
+        } else if (rmsError > checks.maxRmsError) {
+            fail("RMS position error " + std::to_string(rmsError) +
+                 " m exceeds " + std::to_string(checks.maxRmsError) + " m");
+        }
+    }
+    return passed ? 0 : 1;
+}
@@ -28,6 +28,7 @@
 #include "CameraParameters.h"
 #include "ImageSource.h"
 #include "ImageSourceFactories.h"
+#include "TrackingPipeline.h"
 #include <osvr/PluginKit/PluginKit.h>
 #include <osvr/PluginKit/TrackerInterfaceC.h>
 #include <osvr/PluginKit/AnalogInterfaceC.h>
@@ -54,6 +55,7 @@
 #include <iomanip>
 #include <sstream>
 #include <memory>
+#include <chrono>
 
 // Define the constant below to print timing information (how many updates
 // per second we are getting).
@@ -113,6 +115,12 @@ class VideoBasedHMDTracker : boost::noncopyable {
     osvr::vbtracker::VideoBasedTracker &vbtracker() { return m_vbtracker; }
 
   private:
+    /// @brief Whether to run the tracker as a pipeline, rather than
+    /// capturing and processing each frame in turn in update().
+    bool m_shouldPipeline() const;
+    OSVR_ReturnCode m_updatePipelined();
+    void m_sendBeaconDebugInfo();
+
     osvr::pluginkit::DeviceToken m_dev;
     OSVR_TrackerDeviceInterface m_tracker;
     OSVR_AnalogDeviceInterface m_analog;
@@ -125,9 +133,24 @@ class VideoBasedHMDTracker : boost::noncopyable {
     cv::Mat m_imageGray;
 
     osvr::vbtracker::VideoBasedTracker m_vbtracker;
+    /// Declared last so its threads are stopped before anything they use
+    /// is destroyed.
+    std::unique_ptr<osvr::vbtracker::TrackingPipeline> m_pipeline;
 };
 
+inline bool VideoBasedHMDTracker::m_shouldPipeline() const {
+#ifdef VBHMD_SAVE_IMAGES
+    // Frames are only saved by the serial path.
+    return false;
+#else
+    return m_params.pipelined && !m_params.debug;
+#endif
+}
+
 inline OSVR_ReturnCode VideoBasedHMDTracker::update() {
+    if (m_shouldPipeline()) {
+        return m_updatePipelined();
+    }
     if (!m_source->ok()) {
         // Couldn't open the camera.  Failing silently for now. Maybe the
         // camera will be plugged back in later.
@@ -199,28 +222,88 @@ inline OSVR_ReturnCode VideoBasedHMDTracker::update() {
                 shouldSendDebug = true;
             }
         });
-    if (shouldSendDebug && m_params.streamBeaconDebugInfo) {
-        double data[DEBUGGABLE_BEACONS * DATAPOINTS_PER_BEACON];
-        auto &debug = m_vbtracker.getFirstEstimator().getBeaconDebugData();
-        auto now = osvr::util::time::getNow();
-        auto n = std::min(size_t(DEBUGGABLE_BEACONS), debug.size());
-        for (std::size_t i = 0; i < n; ++i) {
-            double *buf = &data[i];
-            auto j = i * DATAPOINTS_PER_BEACON;
-            // yes, using postincrement since we want the previous value
-            // returned. Borderline "too clever" but it's debug code.
-            data[j] = debug[i].variance;
-            data[j + 1] = debug[i].measurement.x;
-            data[j + 2] = debug[i].measurement.y;
-            data[j + 3] = debug[i].residual.x;
-            data[j + 4] = debug[i].residual.y;
-        }
-        osvrDeviceAnalogSetValuesTimestamped(m_dev, m_analog, data, n, &now);
+    if (shouldSendDebug) {
+        m_sendBeaconDebugInfo();
     }
 
     return OSVR_RETURN_SUCCESS;
 }
 
+inline OSVR_ReturnCode VideoBasedHMDTracker::m_updatePipelined() {
+    if (!m_pipeline) {
+        // By now, the sensors have been added.
+        m_pipeline.reset(
+            new osvr::vbtracker::TrackingPipeline(*m_source, m_vbtracker));
+    }
+    bool shouldSendDebug = false;
+    // Waiting here, rather than returning right away, keeps the device
+    // thread from spinning between frames.
+    bool gotFrame = m_pipeline->processNext(
+        [&](OSVR_ChannelCount sensor, OSVR_Pose3 const &pose,
+            OSVR_TimeValue const &timestamp) {
+            // Time-stamped with the time we received the image from the
+            // camera.
+            osvrDeviceTrackerSendPoseTimestamped(m_dev, m_tracker, &pose,
+                                                 sensor, &timestamp);
+            if (sensor == 0) {
+                shouldSendDebug = true;
+            }
+        },
+        std::chrono::milliseconds(100));
+    if (!gotFrame) {
+        return OSVR_RETURN_SUCCESS;
+    }
+    if (shouldSendDebug) {
+        m_sendBeaconDebugInfo();
+    }
+
+#ifdef VBHMD_TIMING
+    static unsigned count = 0;
+    if (++count == 100) {
+        count = 0;
+        auto report = [](const char *name,
+                         osvr::vbtracker::PipelineStageStats const &stats) {
+            if (stats.frames == 0) {
+                return;
+            }
+            std::cout << "  " << name << ": " << stats.frames << " frames, "
+                      << stats.dropped << " dropped, "
+                      << 1000. * stats.busySeconds / stats.frames
+                      << " ms busy and "
+                      << 1000. * stats.latencySeconds / stats.frames
+                      << " ms after capture per frame" << std::endl;
+        };
+        std::cout << "Video-based tracker pipeline:" << std::endl;
+        report("capture", m_pipeline->getCaptureStats());
+        report("blobs", m_pipeline->getBlobStats());
+        report("poses", m_pipeline->getPoseStats());
+    }
+#endif
+    return OSVR_RETURN_SUCCESS;
+}
+
+inline void VideoBasedHMDTracker::m_sendBeaconDebugInfo() {
+    if (!m_params.streamBeaconDebugInfo) {
+        return;
+    }
+    double data[DEBUGGABLE_BEACONS * DATAPOINTS_PER_BEACON];
+    auto &debug = m_vbtracker.getFirstEstimator().getBeaconDebugData();
+    auto now = osvr::util::time::getNow();
+    auto n = std::min(size_t(DEBUGGABLE_BEACONS), debug.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        double *buf = &data[i];
+        auto j = i * DATAPOINTS_PER_BEACON;
+        // yes, using postincrement since we want the previous value
+        // returned. Borderline "too clever" but it's debug code.
+        data[j] = debug[i].variance;
+        data[j + 1] = debug[i].measurement.x;
+        data[j + 2] = debug[i].measurement.y;
+        data[j + 3] = debug[i].residual.x;
+        data[j + 4] = debug[i].residual.y;
+    }
+    osvrDeviceAnalogSetValuesTimestamped(m_dev, m_analog, data, n, &now);
+}
+
 class HardwareDetection {
   public:
     using CameraFactoryType = std::function<osvr::vbtracker::ImageSourcePtr()>;
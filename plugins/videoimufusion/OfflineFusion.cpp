@@ -40,6 +40,7 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <chrono>
 
 namespace ei = osvr::util::eigen_interop;
 
@@ -54,6 +55,11 @@ void processReports(Json::Value const &log) {
     auto firstRunningReport = std::size_t{0};
     bool gotOri = false;
     OSVR_OrientationReport ori;
+    /// Time spent in the fusion code, and how often its output went back in
+    /// time (which a client would drop as out of order).
+    auto fusionTime = std::chrono::steady_clock::duration::zero();
+    auto backwardOutputs = std::size_t{0};
+    OSVR_TimeValue lastOutput = {};
     for (auto &report : log) {
         std::cout << "\n***********************\nReport #" << reportNumber;
         if (gotRunning) {
@@ -68,7 +74,9 @@ void processReports(Json::Value const &log) {
             std::cout << " - IMU" << std::endl;
             gotOri = true;
             ei::map(ori.rotation) = quat;
+            auto start = std::chrono::steady_clock::now();
             fusion.handleIMUData(timestamp, ori);
+            fusionTime += std::chrono::steady_clock::now() - start;
         } else if (path == VIDEO_PATH) {
             std::cout << " - Video-based tracker" << std::endl;
             OSVR_PoseReport pose;
@@ -76,7 +84,9 @@ void processReports(Json::Value const &log) {
                 osvr::common::vec3FromJson(report["translation"]);
             ei::map(pose.pose).rotation() = quat;
             if (fusion.running()) {
+                auto start = std::chrono::steady_clock::now();
                 fusion.handleVideoTrackerDataWhileRunning(timestamp, pose);
+                fusionTime += std::chrono::steady_clock::now() - start;
             } else {
                 if (!gotOri) {
                     std::cout
@@ -99,7 +109,11 @@ void processReports(Json::Value const &log) {
                 firstRunningReport = reportNumber;
                 std::cout << "---- Fusion just switched to running state!"
                           << std::endl;
+            } else if (osvr::util::time::duration(fusion.getLatestTime(),
+                                                  lastOutput) < 0) {
+                ++backwardOutputs;
             }
+            lastOutput = fusion.getLatestTime();
             std::cout << "Error Covariance:\n"
                       << fusion.getErrorCovariance().diagonal() << std::endl;
             if ((fusion.getErrorCovariance().diagonal().array() < 0.).any()) {
@@ -113,6 +127,19 @@ void processReports(Json::Value const &log) {
         }
         reportNumber++;
     }
+    if (gotRunning) {
+        auto runningReports = reportNumber - firstRunningReport;
+        std::cout
+            << "\n***********************\nIn running state, "
+            << runningReports << " reports took "
+            << std::chrono::duration<double, std::micro>(fusionTime).count() /
+                   runningReports
+            << " us each on average.\n"
+            << fusion.getLateReportCount() << " arrived late.\n"
+            << backwardOutputs
+            << " fused reports went back in time from the one before."
+            << std::endl;
+    }
 }
 int main(int argc, char *argv[]) {
     if (argc < 2) {
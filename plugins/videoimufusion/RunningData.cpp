@@ -70,7 +70,7 @@ VideoIMUFusion::RunningData::RunningData(
       m_cameraMeasPos(Vector<3>::Zero(),
                       Vector<3>::Constant(params.videoPosVariance)),
 #endif
-      m_rTc(rTc), m_last(lastTS) {
+      m_rTc(rTc), m_last(lastTS), m_latest(lastTS) {
 
 #ifdef OSVR_FPE
     FPExceptionEnabler fpe;
@@ -60,7 +60,7 @@ inline void dumpKalmanDebugOuput(const char name[], const char expr[],
 // - none
 
 // Standard includes
-// - none
+#include <cstddef>
 
 using ProcessModel = osvr::kalman::PoseDampedConstantVelocityProcessModel;
 using FilterState = ProcessModel::State;
@@ -104,7 +104,18 @@ class VideoIMUFusion::RunningData {
         return state().errorCovariance();
     }
 
+    /// Timestamp of the newest report filtered in so far: the time the
+    /// current state describes.
+    OSVR_TimeValue const &getLatestTime() const { return m_latest; }
+
+    /// Number of reports older than one already filtered in.
+    std::size_t getLateReportCount() const { return m_lateReports; }
+
   private:
+    /// Advances the latest time to the report's timestamp, unless (like a
+    /// video report, stamped with its exposure time) it's older.
+    void stampReport(OSVR_TimeValue const &timestamp);
+
     FilterState &state() { return m_state; }
     FilterState const &state() const { return m_state; }
     ProcessModel &processModel() { return m_processModel; }
@@ -119,6 +130,8 @@ class VideoIMUFusion::RunningData {
 #endif
     const Eigen::Isometry3d m_rTc;
     OSVR_TimeValue m_last;
+    OSVR_TimeValue m_latest;
+    std::size_t m_lateReports = 0;
 };
 
 #endif // INCLUDED_RunningData_h_GUID_6B3479E5_9D56_4BA9_DEC0_84AF53842168
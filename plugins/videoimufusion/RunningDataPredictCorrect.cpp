@@ -43,16 +43,30 @@ namespace ei = osvr::util::eigen_interop;
 void VideoIMUFusion::RunningData::handleIMUReport(
     const OSVR_TimeValue &timestamp, const OSVR_OrientationReport &report) {
     state().setQuaternion(ei::map(report.rotation));
+    stampReport(timestamp);
 }
 
 void VideoIMUFusion::RunningData::handleIMUVelocity(
     const OSVR_TimeValue &timestamp, const Eigen::Vector3d &angVel) {
     state().angularVelocity() = angVel;
+    stampReport(timestamp);
 }
 
 void VideoIMUFusion::RunningData::handleVideoTrackerReport(
     const OSVR_TimeValue &timestamp, const OSVR_PoseReport &report) {
     state().position() = takeCameraPoseToRoom(report.pose).translation();
+    stampReport(timestamp);
+}
+
+void VideoIMUFusion::RunningData::stampReport(
+    const OSVR_TimeValue &timestamp) {
+    // With no predict/correct step to place a report in time, each one just
+    // overwrites its part of the state: the state is as of the newest.
+    if (duration(timestamp, m_latest) < 0) {
+        ++m_lateReports;
+    } else {
+        m_latest = timestamp;
+    }
 }
 
 /// Returns true if we succeeded and can filter in some data.
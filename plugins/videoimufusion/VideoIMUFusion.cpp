@@ -72,6 +72,12 @@ VideoIMUFusion::getErrorCovariance() const {
     return m_runningData->getErrorCovariance();
 }
 
+std::size_t VideoIMUFusion::getLateReportCount() const {
+    BOOST_ASSERT_MSG(running(),
+                     "Only valid if fusion is in the running state!");
+    return m_runningData->getLateReportCount();
+}
+
 void VideoIMUFusion::enterRunningState(
     Eigen::Isometry3d const &rTc, const OSVR_TimeValue &timestamp,
     const OSVR_PoseReport &report, const OSVR_OrientationState &orientation) {
@@ -112,7 +118,7 @@ void VideoIMUFusion::handleIMUData(const OSVR_TimeValue &timestamp,
     m_runningData->handleIMUReport(timestamp, report);
 
     // send a pose report
-    updateFusedOutput(timestamp);
+    updateFusedOutput(m_runningData->getLatestTime());
 }
 void VideoIMUFusion::handleIMUVelocity(const OSVR_TimeValue &timestamp,
                                        const Eigen::Vector3d &angVel) {
@@ -121,7 +127,7 @@ void VideoIMUFusion::handleIMUVelocity(const OSVR_TimeValue &timestamp,
     }
     m_runningData->handleIMUVelocity(timestamp, angVel);
     // send a pose report
-    updateFusedOutput(timestamp);
+    updateFusedOutput(m_runningData->getLatestTime());
 }
 
 void VideoIMUFusion::updateFusedOutput(const OSVR_TimeValue &timestamp) {
@@ -143,7 +149,9 @@ void VideoIMUFusion::handleVideoTrackerDataWhileRunning(
     // Pass this along to the filter
     m_runningData->handleVideoTrackerReport(timestamp, report);
 
-    updateFusedOutput(timestamp);
+    // The report is usually older than the IMU data already filtered in, so
+    // the fused state is still as of the latest time.
+    updateFusedOutput(m_runningData->getLatestTime());
     // For debugging, we will output a second sensor that is just the
     // video tracker data re-oriented.
     Eigen::Isometry3d videoPose =
@@ -35,6 +35,7 @@
 // - none
 
 // Standard includes
+#include <cstddef>
 #include <memory>
 #include <cassert>
 
@@ -100,6 +101,11 @@ class VideoIMUFusion {
     /// Only valid once running state is entered!
     Eigen::Matrix<double, 12, 12> const &getErrorCovariance() const;
 
+    /// Returns the number of reports so far that were older than one
+    /// already handled.
+    /// Only valid once running state is entered!
+    std::size_t getLateReportCount() const;
+
   private:
     void enterCameraPoseAcquisitionState();
     void enterRunningState(Eigen::Isometry3d const &rTc,
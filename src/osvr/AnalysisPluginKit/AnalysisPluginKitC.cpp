@@ -102,7 +102,7 @@ osvrAnalysisSyncInit(OSVR_IN_PTR OSVR_PluginRegContext ctx,
     auto clientCtxSmart = osvr::common::wrapSharedContext(
         osvr::client::createAnalysisClientContext(
             "org.osvr.analysisplugin" /**< @todo */, "localhost" /**< @todo */,
-            vrpn_ConnectionPtr(vrpnConn)));
+            vrpn_ConnectionPtr(vrpnConn), osvrConn->getInProcessReports()));
     auto &dev = **device;
     /// pass ownership
     dev.acquireObject(clientCtxSmart);
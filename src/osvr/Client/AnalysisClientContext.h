@@ -36,6 +36,7 @@
 #include <osvr/Client/RemoteHandlerFactory.h>
 #include <osvr/Client/ClientInterfaceObjectManager.h>
 #include <osvr/Common/PathTreeOwner.h>
+#include <osvr/Common/InProcessReportsPtr.h>
 #include "VRPNConnectionCollection.h"
 
 // Library/third-party includes
@@ -49,9 +50,11 @@ namespace client {
 
     class AnalysisClientContext : public ::OSVR_ClientContextObject {
       public:
-        AnalysisClientContext(const char appId[], const char host[],
-                              vrpn_ConnectionPtr const &conn,
-                              common::ClientContextDeleter del);
+        AnalysisClientContext(
+            const char appId[], const char host[],
+            vrpn_ConnectionPtr const &conn,
+            common::InProcessReportsPtr const &inProcessReports,
+            common::ClientContextDeleter del);
         virtual ~AnalysisClientContext();
         EIGEN_MAKE_ALIGNED_OPERATOR_NEW
       private:
@@ -30,27 +30,51 @@
 #include <osvr/Common/PathTreeOwner.h>
 #include <osvr/Common/ClientInterface.h>
 #include <osvr/Util/Verbosity.h>
-#include <osvr/Common/ResolveTreeNode.h>
+#include <osvr/Common/ResolvedSourceCache.h>
+#include <osvr/Common/PathElementTypes.h>
 
 // Library/third-party includes
 #include <boost/assert.hpp>
+#include <json/writer.h>
 
 // Standard includes
 #include <unordered_set>
+#include <vector>
 
 namespace osvr {
 namespace client {
+    /// @brief Returns a string summarizing everything a remote handler is
+    /// constructed from.
+    static inline std::string
+    getSourceSignature(common::OriginalSource const &source) {
+        auto const &devElt = source.getDeviceElement();
+        auto sensor = source.getSensorNumber();
+        Json::FastWriter writer;
+        std::string ret = source.getDevicePath();
+        ret += '\n';
+        ret += devElt.getFullDeviceName();
+        ret += '\n';
+        ret += source.getInterfaceName();
+        ret += '\n';
+        ret += sensor ? std::to_string(*sensor) : std::string("-");
+        ret += '\n';
+        if (source.hasTransform()) {
+            ret += writer.write(source.getTransformJson());
+        }
+        ret += '\n';
+        ret += writer.write(devElt.getDescriptor());
+        return ret;
+    }
+
     ClientInterfaceObjectManager::ClientInterfaceObjectManager(
         common::PathTreeOwner &tree, RemoteHandlerFactory &handlerFactory,
         common::ClientContext &ctx)
-        : m_pathTree(tree.get()), m_treeObserver(tree.makeObserver()),
-          m_factory(handlerFactory), m_ctx(&ctx) {
-        m_treeObserver->setEventCallback(
-            common::PathTreeEvents::AboutToUpdate,
-            [&](common::PathTree &) { m_interfaces.clearHandlers(); });
+        : m_treeOwner(tree), m_pathTree(tree.get()),
+          m_treeObserver(tree.makeObserver()), m_factory(handlerFactory),
+          m_ctx(&ctx), m_sourcesGeneration(tree.getGeneration()) {
         m_treeObserver->setEventCallback(
             common::PathTreeEvents::AfterUpdate,
-            [&](common::PathTree &) { m_connectNeededCallbacks(); });
+            [&](common::PathTree &) { m_refreshChangedHandlers(); });
     }
 
     void ClientInterfaceObjectManager::addInterface(
@@ -79,9 +103,9 @@ namespace client {
         /// Start by removing handler from interface tree and handler container
         /// for this path, if found. Ensures that if we early-out (fail to set
         /// up a handler) we don't have a leftover one still active.
-        m_interfaces.eraseHandlerForPath(path);
+        m_removeCallbacksOnPath(path);
 
-        auto source = common::resolveTreeNode(m_pathTree, path);
+        auto const &source = m_sources.resolve(m_pathTree, path);
         if (!source.is_initialized()) {
             OSVR_DEV_VERBOSE("Could not resolve source for " << path);
             return false;
@@ -97,6 +121,7 @@ namespace client {
             BOOST_ASSERT_MSG(
                 !oldHandler,
                 "We removed the old handler before so it should be null now");
+            m_handlerSources[path] = getSourceSignature(*source);
             return true;
         }
 
@@ -109,6 +134,7 @@ namespace client {
     void ClientInterfaceObjectManager::m_removeCallbacksOnPath(
         std::string const &path) {
         m_interfaces.eraseHandlerForPath(path);
+        m_handlerSources.erase(path);
     }
 
     void ClientInterfaceObjectManager::m_connectNeededCallbacks() {
@@ -128,5 +154,41 @@ namespace client {
                                       << successfulPaths + failedPaths.size()
                                       << " unconnected paths successfully");
     }
+
+    void ClientInterfaceObjectManager::m_refreshChangedHandlers() {
+        if (m_treeOwner.getGeneration() != m_sourcesGeneration) {
+            // Whole new tree: nothing cached is valid.
+            m_sources.clear();
+            m_sourcesGeneration = m_treeOwner.getGeneration();
+        } else {
+            for (auto const &path : m_treeOwner.getLastDeltaPaths()) {
+                m_sources.invalidate(path);
+            }
+        }
+
+        auto kept = size_t{0};
+        std::vector<std::string> changedPaths;
+        m_interfaces.visitPathsWithHandlers([&](std::string const &path) {
+            if (m_sources.contains(path)) {
+                // Nothing this path's resolution depended on has changed.
+                kept++;
+                return;
+            }
+            auto const &source = m_sources.resolve(m_pathTree, path);
+            auto it = m_handlerSources.find(path);
+            if (source && it != end(m_handlerSources) &&
+                it->second == getSourceSignature(*source)) {
+                kept++;
+                return;
+            }
+            changedPaths.push_back(path);
+        });
+        for (auto const &path : changedPaths) {
+            m_removeCallbacksOnPath(path);
+        }
+        OSVR_DEV_VERBOSE("Kept " << kept << " of " << kept + changedPaths.size()
+                                 << " handlers across path tree update");
+        m_connectNeededCallbacks();
+    }
 } // namespace client
 } // namespace osvr
@@ -30,6 +30,7 @@
 #include <osvr/Common/PathElementTools.h>
 #include <osvr/Common/PathElementTypes.h>
 #include <osvr/Common/ClientInterface.h>
+#include <osvr/Common/Tracing.h>
 #include <osvr/Util/Verbosity.h>
 #include <osvr/Common/DeduplicatingFunctionWrapper.h>
 
@@ -106,6 +107,9 @@ namespace client {
         m_systemDevice = common::createClientDevice(sysDeviceName, m_mainConn);
         m_systemComponent =
             m_systemDevice->addComponent(common::SystemComponent::create());
+        // Without deltas, the server re-sends the whole tree whenever a
+        // client connects: skip rebuilding ours if it hasn't changed. (With
+        // deltas, full trees come through the delta handler instead.)
         using DedupJsonFunction =
             common::DeduplicatingFunctionWrapper<Json::Value const &>;
         m_systemComponent->registerReplaceTreeHandler(
@@ -119,9 +123,22 @@ namespace client {
                 replaceLocalhostServers(nodes, m_host);
 
                 // Tree observers will handle destruction/creation of remote
-                // handlers.
+                // handlers - only for those paths whose source changed.
                 m_pathTreeOwner.replaceTree(nodes);
             }));
+        m_systemComponent->registerTreeDeltaHandler(
+            [&](Json::Value delta, util::time::TimeValue const &) {
+                // Same localhost treatment as for full trees.
+                replaceLocalhostServers(delta["added"], m_host);
+                replaceLocalhostServers(delta["changed"], m_host);
+                if (delta.isMember("nodes")) {
+                    replaceLocalhostServers(delta["nodes"], m_host);
+                }
+                if (!m_pathTreeOwner.applyTreeDelta(delta)) {
+                    // Out of step with the server: ask for the whole tree.
+                    m_systemComponent->sendTreeRequest();
+                }
+            });
 
         typedef std::chrono::system_clock clock;
         auto begin = clock::now();
@@ -174,7 +191,10 @@ namespace client {
         /// Update system device
         m_systemDevice->update();
         /// Update handlers.
-        m_ifaceMgr.updateHandlers();
+        {
+            common::tracing::ClientHandlerDispatch trace;
+            m_ifaceMgr.updateHandlers();
+        }
     }
 
     void PureClientContext::m_sendRoute(std::string const &route) {
@@ -43,8 +43,15 @@ namespace osvr {
 namespace client {
     void populateRemoteHandlerFactory(RemoteHandlerFactory &factory,
                                       VRPNConnectionCollection const &conns) {
+        populateRemoteHandlerFactory(factory, conns,
+                                     common::InProcessReportsPtr());
+    }
+
+    void populateRemoteHandlerFactory(
+        RemoteHandlerFactory &factory, VRPNConnectionCollection const &conns,
+        common::InProcessReportsPtr const &inProcessReports) {
         /// Register all the factories.
-        TrackerRemoteFactory(conns).registerWith(factory);
+        TrackerRemoteFactory(conns, inProcessReports).registerWith(factory);
         AnalogRemoteFactory(conns).registerWith(factory);
         ButtonRemoteFactory(conns).registerWith(factory);
         ImagingRemoteFactory(conns).registerWith(factory);
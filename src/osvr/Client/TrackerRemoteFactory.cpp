@@ -33,6 +33,7 @@
 #include <osvr/Util/ChannelCountC.h>
 #include <osvr/Util/UniquePtr.h>
 #include <osvr/Common/Transform.h>
+#include <osvr/Common/CompiledTransform.h>
 #include <osvr/Common/OriginalSource.h>
 #include <osvr/Common/JSONTransformVisitor.h>
 #include "PureClientContext.h"
@@ -40,6 +41,7 @@
 #include <osvr/Util/Verbosity.h>
 #include <osvr/Common/Tracing.h>
 #include <osvr/Common/TrackerSensorInfo.h>
+#include <osvr/Common/InProcessReports.h>
 
 // Library/third-party includes
 #include <vrpn_Tracker.h>
@@ -50,29 +52,176 @@
 #include <json/reader.h>
 
 // Standard includes
-// - none
+#include <cstdint>
+#include <string>
 
 namespace ei = osvr::util::eigen_interop;
 
 namespace osvr {
 namespace client {
-    class VRPNTrackerHandler : public RemoteHandler {
+    class VRPNTrackerHandler : public RemoteHandler,
+                               public common::TrackerReportListener {
       public:
         struct Options {
             bool reportPose = false;
             bool reportPosition = false;
             bool reportOrientation = false;
         };
+        /// @param inProcess If not null, the channel on which the device
+        /// itself hands over its reports when it's in this process: the VRPN
+        /// remote is used only while nothing publishes there.
         VRPNTrackerHandler(vrpn_ConnectionPtr const &conn, const char *src,
                            Options const &options,
                            common::TrackerSensorInfo const &info,
                            common::Transform const &t,
                            boost::optional<int> sensor,
                            common::InterfaceList &ifaces,
-                           common::ClientContext &ctx)
-            : m_remote(new vrpn_Tracker_Remote(src, conn.get())),
-              m_transform(t), m_ctx(ctx), m_internals(ifaces), m_opts(options),
-              m_info(info), m_sensor(sensor) {
+                           common::ClientContext &ctx,
+                           common::InProcessReportsPtr const &reports,
+                           common::InProcessTrackerChannel *inProcess)
+            : m_conn(conn), m_src(src), m_transform(t), m_ctx(ctx),
+              m_internals(ifaces), m_opts(options), m_info(info),
+              m_sensor(sensor), m_inProcessReports(reports),
+              m_inProcess(inProcess) {
+            m_updateCompiledTransform();
+            if (m_inProcess) {
+                m_inProcess->addListener(*this);
+            }
+            if (!m_isInProcess()) {
+                m_createRemote();
+            }
+            OSVR_DEV_VERBOSE("Constructed a TrackerHandler for "
+                             << src << " sensor " << m_sensor.get_value_or(-1)
+                             << (m_isInProcess() ? " (in process)" : ""));
+        }
+        virtual ~VRPNTrackerHandler() {
+            m_destroyRemote();
+            if (m_inProcess) {
+                m_inProcess->removeListener(*this);
+            }
+        }
+
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+        common::Transform getCurrentTransform() const {
+            auto ret = m_transform;
+            ret.transform(m_ctx.getRoomToWorldTransform());
+            return ret;
+        }
+
+        /// @brief Gets the current transform prepared for application,
+        /// recompiling it only if the room to world transform has changed
+        /// since it was last compiled.
+        common::CompiledTransform const &getCompiledTransform() {
+            if (m_ctx.getRoomToWorldTransformVersion() !=
+                m_compiledRoomToWorldVersion) {
+                m_updateCompiledTransform();
+            }
+            return m_compiled;
+        }
+
+        static void VRPN_CALLBACK handle(void *userdata, vrpn_TRACKERCB info) {
+            auto self = static_cast<VRPNTrackerHandler *>(userdata);
+            if (self->m_isInProcess()) {
+                // Already heard directly from the device.
+                return;
+            }
+            OSVR_PoseState pose;
+            osvrQuatFromQuatlib(&(pose.rotation), info.quat);
+            osvrVec3FromQuatlib(&(pose.translation), info.pos);
+            self->m_handlePose(info.sensor, pose, m_getTimestamp(info));
+        }
+        static void VRPN_CALLBACK handleVel(void *userdata,
+                                            vrpn_TRACKERVELCB info) {
+            auto self = static_cast<VRPNTrackerHandler *>(userdata);
+            if (self->m_isInProcess()) {
+                return;
+            }
+            OSVR_VelocityState vel;
+            osvrVec3FromQuatlib(&(vel.linearVelocity), info.vel);
+            osvrQuatFromQuatlib(&(vel.angularVelocity.incrementalRotation),
+                                info.vel_quat);
+            vel.angularVelocity.dt = info.vel_quat_dt;
+            self->m_handleVelocity(info.sensor, vel, m_getTimestamp(info));
+        }
+        static void VRPN_CALLBACK handleAccel(void *userdata,
+                                              vrpn_TRACKERACCCB info) {
+            auto self = static_cast<VRPNTrackerHandler *>(userdata);
+            if (self->m_isInProcess()) {
+                return;
+            }
+            OSVR_AccelerationState accel;
+            osvrVec3FromQuatlib(&(accel.linearAcceleration), info.acc);
+            osvrQuatFromQuatlib(
+                &(accel.angularAcceleration.incrementalRotation),
+                info.acc_quat);
+            accel.angularAcceleration.dt = info.acc_quat_dt;
+            self->m_handleAcceleration(info.sensor, accel,
+                                       m_getTimestamp(info));
+        }
+
+        /// @name In-process reports, straight from the device
+        /// @{
+        void handlePose(OSVR_ChannelCount sensor, OSVR_PoseState const &pose,
+                        util::time::TimeValue const &timestamp) override {
+            if (m_wantsSensor(sensor) &&
+                (m_info.reportsPosition || m_info.reportsOrientation)) {
+                m_handlePose(sensor, pose, timestamp);
+            }
+        }
+        void handleVelocity(OSVR_ChannelCount sensor,
+                            OSVR_VelocityState const &vel,
+                            util::time::TimeValue const &timestamp) override {
+            if (m_wantsSensor(sensor) && (m_info.reportsLinearVelocity ||
+                                          m_info.reportsAngularVelocity)) {
+                m_handleVelocity(sensor, vel, timestamp);
+            }
+        }
+        void
+        handleAcceleration(OSVR_ChannelCount sensor,
+                           OSVR_AccelerationState const &accel,
+                           util::time::TimeValue const &timestamp) override {
+            if (m_wantsSensor(sensor) && (m_info.reportsLinearAcceleration ||
+                                          m_info.reportsAngularAcceleration)) {
+                m_handleAcceleration(sensor, accel, timestamp);
+            }
+        }
+        /// @}
+
+        virtual void update() {
+            if (m_isInProcess()) {
+                // The device may have started publishing since we connected.
+                m_destroyRemote();
+                return;
+            }
+            if (!m_remote) {
+                // ...or may have gone away, leaving only the network.
+                m_createRemote();
+            }
+            m_remote->mainloop();
+        }
+
+      private:
+        bool m_isInProcess() const {
+            return m_inProcess && m_inProcess->hasPublisher();
+        }
+
+        /// @brief Matches the sensor filtering VRPN does for change handlers.
+        bool m_wantsSensor(OSVR_ChannelCount sensor) const {
+            return !m_sensor ||
+                   static_cast<OSVR_ChannelCount>(*m_sensor) == sensor;
+        }
+
+        template <typename T>
+        static util::time::TimeValue m_getTimestamp(T const &info) {
+            util::time::TimeValue timestamp;
+            osvrStructTimevalToTimeValue(&timestamp, &(info.msg_time));
+            return timestamp;
+        }
+
+        void m_createRemote() {
+            m_remote.reset(
+                new vrpn_Tracker_Remote(m_src.c_str(), m_conn.get()));
             if (m_info.reportsPosition || m_info.reportsOrientation) {
                 m_remote->register_change_handler(this,
                                                   &VRPNTrackerHandler::handle,
@@ -89,10 +238,12 @@ namespace client {
                     this, &VRPNTrackerHandler::handleAccel,
                     m_sensor.get_value_or(-1));
             }
-            OSVR_DEV_VERBOSE("Constructed a TrackerHandler for "
-                             << src << " sensor " << m_sensor.get_value_or(-1));
         }
-        virtual ~VRPNTrackerHandler() {
+
+        void m_destroyRemote() {
+            if (!m_remote) {
+                return;
+            }
             if (m_info.reportsPosition || m_info.reportsOrientation) {
                 m_remote->unregister_change_handler(this,
                                                     &VRPNTrackerHandler::handle,
@@ -109,45 +260,23 @@ namespace client {
                     this, &VRPNTrackerHandler::handleAccel,
                     m_sensor.get_value_or(-1));
             }
+            m_remote.reset();
         }
 
-        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
-
-        common::Transform getCurrentTransform() const {
-            auto ret = m_transform;
-            ret.transform(m_ctx.getRoomToWorldTransform());
-            return ret;
-        }
-
-        static void VRPN_CALLBACK handle(void *userdata, vrpn_TRACKERCB info) {
-            auto self = static_cast<VRPNTrackerHandler *>(userdata);
-            self->m_handle(info);
-        }
-        static void VRPN_CALLBACK handleVel(void *userdata,
-                                            vrpn_TRACKERVELCB info) {
-            auto self = static_cast<VRPNTrackerHandler *>(userdata);
-            self->m_handle(info);
-        }
-        static void VRPN_CALLBACK handleAccel(void *userdata,
-                                              vrpn_TRACKERACCCB info) {
-            auto self = static_cast<VRPNTrackerHandler *>(userdata);
-            self->m_handle(info);
+        void m_updateCompiledTransform() {
+            m_compiledRoomToWorldVersion =
+                m_ctx.getRoomToWorldTransformVersion();
+            m_compiled = common::CompiledTransform(getCurrentTransform());
         }
-        virtual void update() { m_remote->mainloop(); }
 
-      private:
         /// Pass pose messages on to the client
-        void m_handle(vrpn_TRACKERCB const &info) {
+        void m_handlePose(OSVR_ChannelCount sensor, OSVR_PoseState const &pose,
+                          util::time::TimeValue const &timestamp) {
             common::tracing::markNewTrackerData();
             OSVR_PoseReport report;
-            report.sensor = info.sensor;
-            OSVR_TimeValue timestamp;
-            osvrStructTimevalToTimeValue(&timestamp, &(info.msg_time));
-            osvrQuatFromQuatlib(&(report.pose.rotation), info.quat);
-            osvrVec3FromQuatlib(&(report.pose.translation), info.pos);
-            auto xform = getCurrentTransform();
-            ei::map(report.pose) =
-                xform.transform(ei::map(report.pose).matrix());
+            report.sensor = sensor;
+            report.pose = pose;
+            getCompiledTransform().applyToPose(report.pose);
 
             if (m_opts.reportPose) {
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
@@ -155,7 +284,7 @@ namespace client {
 
             if (m_opts.reportPosition) {
                 OSVR_PositionReport positionReport;
-                positionReport.sensor = info.sensor;
+                positionReport.sensor = sensor;
                 positionReport.xyz = report.pose.translation;
 
                 m_internals.setStateAndTriggerCallbacks(timestamp,
@@ -164,7 +293,7 @@ namespace client {
 
             if (m_opts.reportOrientation) {
                 OSVR_OrientationReport oriReport;
-                oriReport.sensor = info.sensor;
+                oriReport.sensor = sensor;
                 oriReport.rotation = report.pose.rotation;
 
                 m_internals.setStateAndTriggerCallbacks(timestamp, oriReport);
@@ -172,28 +301,26 @@ namespace client {
         }
 
         /// Pass velocity messages on to the client
-        void m_handle(vrpn_TRACKERVELCB const &info) {
+        void m_handleVelocity(OSVR_ChannelCount sensor,
+                              OSVR_VelocityState const &velocity,
+                              util::time::TimeValue const &timestamp) {
             /// @todo should we be marking a trace event here?
             // common::tracing::markNewTrackerData();
 
-            OSVR_TimeValue timestamp;
-            osvrStructTimevalToTimeValue(&timestamp, &(info.msg_time));
-
             OSVR_VelocityReport overallReport;
-            overallReport.sensor = info.sensor;
-            auto xform = getCurrentTransform();
+            overallReport.sensor = sensor;
+            auto const &xform = getCompiledTransform();
 
             overallReport.state.linearVelocityValid =
                 m_info.reportsLinearVelocity;
             if (m_info.reportsLinearVelocity) {
-                OSVR_LinearVelocityState vel;
-                osvrVec3FromQuatlib(&(vel), info.vel);
+                OSVR_LinearVelocityState vel = velocity.linearVelocity;
 
-                ei::map(vel) = xform.transformLinear(ei::map(vel));
+                ei::map(vel) = xform.applyLinear(ei::map(vel));
 
                 overallReport.state.linearVelocity = vel;
                 OSVR_LinearVelocityReport report;
-                report.sensor = info.sensor;
+                report.sensor = sensor;
                 report.state = vel;
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
             }
@@ -201,17 +328,14 @@ namespace client {
             overallReport.state.angularVelocityValid =
                 m_info.reportsAngularVelocity;
             if (m_info.reportsAngularVelocity) {
-                OSVR_AngularVelocityState state;
-                osvrQuatFromQuatlib(&(state.incrementalRotation),
-                                    info.vel_quat);
-                state.dt = info.vel_quat_dt;
+                OSVR_AngularVelocityState state = velocity.angularVelocity;
 
                 ei::map(state.incrementalRotation) =
-                    xform.transformLinear(ei::map(state.incrementalRotation));
+                    xform.applyLinear(ei::map(state.incrementalRotation));
 
                 overallReport.state.angularVelocity = state;
                 OSVR_AngularVelocityReport report;
-                report.sensor = info.sensor;
+                report.sensor = sensor;
                 report.state = state;
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
             }
@@ -220,28 +344,28 @@ namespace client {
         }
 
         /// Pass acceleration messages on to the client
-        void m_handle(vrpn_TRACKERACCCB const &info) {
+        void m_handleAcceleration(OSVR_ChannelCount sensor,
+                                  OSVR_AccelerationState const &acceleration,
+                                  util::time::TimeValue const &timestamp) {
             /// @todo should we be marking a trace event here?
             // common::tracing::markNewTrackerData();
-            OSVR_TimeValue timestamp;
-            osvrStructTimevalToTimeValue(&timestamp, &(info.msg_time));
 
             OSVR_AccelerationReport overallReport;
-            overallReport.sensor = info.sensor;
+            overallReport.sensor = sensor;
 
-            auto xform = getCurrentTransform();
+            auto const &xform = getCompiledTransform();
 
             overallReport.state.linearAccelerationValid =
                 m_info.reportsLinearAcceleration;
             if (m_info.reportsLinearAcceleration) {
-                OSVR_LinearAccelerationState accel;
-                osvrVec3FromQuatlib(&(accel), info.acc);
+                OSVR_LinearAccelerationState accel =
+                    acceleration.linearAcceleration;
 
-                ei::map(accel) = xform.transformLinear(ei::map(accel));
+                ei::map(accel) = xform.applyLinear(ei::map(accel));
 
                 overallReport.state.linearAcceleration = accel;
                 OSVR_LinearAccelerationReport report;
-                report.sensor = info.sensor;
+                report.sensor = sensor;
                 report.state = accel;
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
             }
@@ -249,35 +373,40 @@ namespace client {
                 m_info.reportsAngularAcceleration;
             if (m_info.reportsAngularAcceleration) {
 
-                OSVR_AngularAccelerationState state;
-                osvrQuatFromQuatlib(&(state.incrementalRotation),
-                                    info.acc_quat);
-                state.dt = info.acc_quat_dt;
+                OSVR_AngularAccelerationState state =
+                    acceleration.angularAcceleration;
 
                 ei::map(state.incrementalRotation) =
-                    xform.transformLinear(ei::map(state.incrementalRotation));
+                    xform.applyLinear(ei::map(state.incrementalRotation));
 
                 overallReport.state.angularAcceleration = state;
                 OSVR_AngularAccelerationReport report;
-                report.sensor = info.sensor;
+                report.sensor = sensor;
                 report.state = state;
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
             }
 
             m_internals.setStateAndTriggerCallbacks(timestamp, overallReport);
         }
+        vrpn_ConnectionPtr m_conn;
+        std::string m_src;
         unique_ptr<vrpn_Tracker_Remote> m_remote;
         common::Transform m_transform;
+        common::CompiledTransform m_compiled;
+        std::uint64_t m_compiledRoomToWorldVersion = 0;
         common::ClientContext &m_ctx;
         RemoteHandlerInternals m_internals;
         Options m_opts;
         common::TrackerSensorInfo m_info;
         boost::optional<int> m_sensor;
+        common::InProcessReportsPtr m_inProcessReports;
+        common::InProcessTrackerChannel *m_inProcess;
     };
 
     TrackerRemoteFactory::TrackerRemoteFactory(
-        VRPNConnectionCollection const &conns)
-        : m_conns(conns) {}
+        VRPNConnectionCollection const &conns,
+        common::InProcessReportsPtr const &inProcessReports)
+        : m_conns(conns), m_inProcessReports(inProcessReports) {}
 
     shared_ptr<RemoteHandler> TrackerRemoteFactory::
     operator()(common::OriginalSource const &source,
@@ -304,10 +433,18 @@ namespace client {
             xform = xformParse.getTransform();
         }
 
+        /// Devices in this process may hand us their reports directly.
+        common::InProcessTrackerChannel *inProcess = nullptr;
+        if (m_inProcessReports && devElt.getServer() == "localhost") {
+            inProcess = &(m_inProcessReports->getTrackerChannel(
+                devElt.getDeviceName()));
+        }
+
         /// @todo find out why make_shared causes a crash here
         ret.reset(new VRPNTrackerHandler(
             m_conns.getConnection(devElt), devElt.getFullDeviceName().c_str(),
-            opts, info, xform, source.getSensorNumber(), ifaces, ctx));
+            opts, info, xform, source.getSensorNumber(), ifaces, ctx,
+            m_inProcessReports, inProcess));
         return ret;
     }
 
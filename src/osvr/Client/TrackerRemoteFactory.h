@@ -29,6 +29,7 @@
 #include "VRPNConnectionCollection.h"
 #include <osvr/Common/InterfaceList.h>
 #include <osvr/Common/OriginalSource.h>
+#include <osvr/Common/InProcessReportsPtr.h>
 #include <osvr/Util/SharedPtr.h>
 #include <osvr/Client/RemoteHandler.h>
 
@@ -45,7 +46,12 @@ namespace client {
 
     class TrackerRemoteFactory {
       public:
-        TrackerRemoteFactory(VRPNConnectionCollection const &conns);
+        /// @param inProcessReports If not null, the hub through which
+        /// trackers in this process can deliver their reports directly.
+        TrackerRemoteFactory(
+            VRPNConnectionCollection const &conns,
+            common::InProcessReportsPtr const &inProcessReports =
+                common::InProcessReportsPtr());
 
         template <typename T> void registerWith(T &factory) const {
             factory.addFactory("tracker", *this);
@@ -57,6 +63,7 @@ namespace client {
 
       private:
         VRPNConnectionCollection m_conns;
+        common::InProcessReportsPtr m_inProcessReports;
     };
 
 } // namespace client
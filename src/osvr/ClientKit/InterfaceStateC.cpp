@@ -25,12 +25,14 @@
 // Internal Includes
 #include <osvr/ClientKit/InterfaceStateC.h>
 #include <osvr/Common/ClientInterface.h>
+#include <osvr/Util/PoseExtrapolation.h>
+#include <osvr/Util/TimeValue.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <cmath>
 
 #define OSVR_CALLBACK_METHODS(TYPE)                                            \
     OSVR_ReturnCode osvrGet##TYPE##State(OSVR_ClientInterface iface,           \
@@ -61,3 +63,45 @@ OSVR_CALLBACK_METHODS(NaviVelocity)
 OSVR_CALLBACK_METHODS(NaviPosition)
 
 #undef OSVR_CALLBACK_METHODS
+
+OSVR_ReturnCode osvrGetPoseStateAtTime(OSVR_ClientInterface iface,
+                                       struct OSVR_TimeValue const *atTime,
+                                       double maxPrediction,
+                                       OSVR_PoseState *state,
+                                       OSVR_CBool *predictionValid) {
+    if (!iface || !atTime || !state || !predictionValid ||
+        !(maxPrediction >= 0)) {
+        return OSVR_RETURN_FAILURE;
+    }
+    *predictionValid = OSVR_FALSE;
+    // One snapshot, so the velocity can't be replaced between reading it and
+    // the pose it's applied to.
+    osvr::common::MotionState motion;
+    if (!iface->getMotionState(motion) || !motion.hasPose) {
+        return OSVR_RETURN_FAILURE;
+    }
+    *state = motion.pose;
+    if (!motion.hasVelocity) {
+        // No velocity, so the best we can do is the last pose.
+        return OSVR_RETURN_SUCCESS;
+    }
+    auto const &poseTime = motion.poseTimestamp;
+    auto const &vel = motion.velocity;
+    if (std::abs(osvr::util::time::duration(motion.velocityTimestamp,
+                                            poseTime)) > maxPrediction) {
+        // Velocity this stale says little about the motion since the pose.
+        return OSVR_RETURN_SUCCESS;
+    }
+
+    auto dt = osvr::util::time::duration(*atTime, poseTime);
+    bool clamped = false;
+    if (std::abs(dt) > maxPrediction) {
+        dt = dt < 0 ? -maxPrediction : maxPrediction;
+        clamped = true;
+    }
+    osvr::util::extrapolatePose(*state, vel, dt);
+    if (!clamped && (vel.linearVelocityValid || vel.angularVelocityValid)) {
+        *predictionValid = OSVR_TRUE;
+    }
+    return OSVR_RETURN_SUCCESS;
+}
@@ -138,6 +138,7 @@ OSVR_ClientContextObject::getRoomToWorldTransform() const {
 void OSVR_ClientContextObject::setRoomToWorldTransform(
     osvr::common::Transform const &xform) {
     m_setRoomToWorldTransform(xform);
+    ++m_roomToWorldVersion;
 }
 
 ClientContextDeleter OSVR_ClientContextObject::getDeleter() const {
@@ -27,7 +27,7 @@
 #include "IPCRingBufferResults.h"
 #include "IPCRingBufferSharedObjects.h"
 #include "SharedMemory.h"
-#include "SharedMemoryObjectWithMutex.h"
+#include <osvr/Util/AlignedMemory.h>
 #include <osvr/Util/ImagingReportTypesC.h>
 #include <osvr/Util/Verbosity.h>
 
@@ -47,7 +47,10 @@ namespace common {
     /// shared-memory objects (Bookkeeping, ElementData) changes, if Boost
     /// Interprocess changes affect the utilized ABI, or if other changes occur
     /// that would interfere with communication.
-    static IPCRingBuffer::abi_level_type SHM_SOURCE_ABI_LEVEL = 0;
+    ///
+    /// Level 1: per-element seqlocks and an atomic publish counter replaced
+    /// the interprocess mutexes.
+    static IPCRingBuffer::abi_level_type SHM_SOURCE_ABI_LEVEL = 1;
 
 /// Some tests that can be automated for ensuring validity of the ABI level
 /// number.
@@ -237,6 +240,14 @@ namespace common {
         }
     }
 
+    void IPCRingBuffer::BufferWriteProxy::abort() {
+        if (m_data) {
+            m_data->abort();
+            m_data.reset();
+        }
+        m_buf = nullptr;
+    }
+
     IPCRingBuffer::BufferReadProxy::BufferReadProxy(
         detail::IPCGetResultPtr &&data, IPCRingBufferPtr &&shm)
         : m_buf(nullptr), m_seq(0), m_data(std::move(data)) {
@@ -303,29 +314,28 @@ namespace common {
 
         detail::IPCGetResultPtr get(sequence_type num) {
             detail::IPCGetResultPtr ret;
-            auto boundsLock = m_bookkeeping->getSharableLock();
-            auto elt = m_bookkeeping->getBySequenceNumber(num, boundsLock);
-            if (nullptr != elt) {
-                auto readerLock = elt->getSharableLock();
-                auto buf = elt->getBuf(readerLock);
-                /// The nullptr will be filled in by the main object.
-                ret.reset(new detail::IPCGetResult{buf, std::move(readerLock),
-                                                   num, nullptr});
+            auto buf = static_cast<BufferType *>(util::alignedAlloc(
+                m_bookkeeping->getBufferLength(), m_opts.getAlignment()));
+            if (nullptr == buf) {
+                return ret;
+            }
+            /// The nullptr will be filled in by the main object.
+            ret.reset(new detail::IPCGetResult{buf, num, nullptr});
+            if (!m_bookkeeping->copyOut(num, buf)) {
+                // Never written, already overwritten, or overwritten while we
+                // were copying it.
+                ret.reset();
             }
             return ret;
         }
 
         detail::IPCGetResultPtr getLatest() {
             detail::IPCGetResultPtr ret;
-            auto boundsLock = m_bookkeeping->getSharableLock();
-            auto elt = m_bookkeeping->back(boundsLock);
-            if (nullptr != elt) {
-                auto readerLock = elt->getSharableLock();
-                auto buf = elt->getBuf(readerLock);
-                /// The nullptr will be filled in by the main object.
-                ret.reset(new detail::IPCGetResult{
-                    buf, std::move(readerLock),
-                    m_bookkeeping->backSequenceNumber(boundsLock), nullptr});
+            // The latest entry can only be overwritten during the copy if the
+            // writer laps the whole ring meanwhile, so a retry is plenty.
+            for (int attempt = 0; attempt < LATEST_ATTEMPTS && !ret;
+                 ++attempt) {
+                ret = get(m_bookkeeping->backSequenceNumber());
             }
             return ret;
         }
@@ -333,6 +343,7 @@ namespace common {
         Options const &getOpts() const { return m_opts; }
 
       private:
+        static const int LATEST_ATTEMPTS = 3;
         unique_ptr<SharedMemorySegmentHolder> m_seg;
         detail::Bookkeeping *m_bookkeeping;
 
@@ -27,8 +27,7 @@
 
 // Internal Includes
 #include <osvr/Common/IPCRingBuffer.h>
-#include "SharedMemory.h"
-#include "SharedMemoryObjectWithMutex.h"
+#include <osvr/Util/AlignedMemory.h>
 
 // Library/third-party includes
 // - none
@@ -40,32 +39,29 @@ namespace osvr {
 namespace common {
 
     namespace detail {
+        class ElementData;
+        class Bookkeeping;
+
+        /// @brief An element being written: publishes it on destruction,
+        /// unless aborted.
         struct IPCPutResult {
-            ~IPCPutResult() {
-#ifdef OSVR_SHM_LOCK_DEBUGGING
-                OSVR_DEV_VERBOSE("Releasing exclusive lock on sequence "
-                                 << seq);
-#endif
-                elementLock.unlock();
-                boundsLock.unlock();
-            }
+            inline ~IPCPutResult();
+            /// @brief Don't publish the element. It stays marked as being
+            /// written (so unreadable), and the next put reuses it along with
+            /// its sequence number.
+            void abort() { bookkeeping = nullptr; }
             IPCRingBuffer::value_type *buffer;
             IPCRingBuffer::sequence_type seq;
-            ipc::exclusive_lock_type elementLock;
-            ipc::exclusive_lock_type boundsLock;
+            ElementData *element;
+            Bookkeeping *bookkeeping;
             IPCRingBufferPtr shm;
         };
 
+        /// @brief A consistent copy of an element, made without blocking the
+        /// writer: owns the (aligned) copy.
         struct IPCGetResult {
-
-            ~IPCGetResult() {
-#ifdef OSVR_SHM_LOCK_DEBUGGING
-                OSVR_DEV_VERBOSE("Releasing shared lock on sequence " << seq);
-#endif
-                elementLock.unlock();
-            }
+            ~IPCGetResult() { util::alignedFree(buffer); }
             IPCRingBuffer::value_type *buffer;
-            ipc::sharable_lock_type elementLock;
             IPCRingBuffer::sequence_type seq;
             IPCRingBufferPtr shm;
         };
@@ -29,7 +29,7 @@
 // Internal Includes
 #include <osvr/Common/IPCRingBuffer.h>
 #include "IPCRingBufferResults.h"
-#include "SharedMemoryObjectWithMutex.h"
+#include "SharedMemory.h"
 #include <osvr/Util/StdInt.h>
 #include <osvr/Util/Verbosity.h>
 
@@ -37,6 +37,8 @@
 #include <boost/noncopyable.hpp>
 
 // Standard includes
+#include <atomic>
+#include <cstring>
 #include <utility>
 
 namespace osvr {
@@ -45,16 +47,66 @@ namespace common {
     namespace detail {
         namespace bip = boost::interprocess;
 
-        class ElementData : public ipc::ObjectWithMutex, boost::noncopyable {
+        /// @brief Type of the per-element generation counter.
+        typedef uint32_t generation_type;
+
+        static_assert(ATOMIC_INT_LOCK_FREE == 2,
+                      "The shared memory ring buffer requires always-lock-free "
+                      "32-bit atomics, so that they work across processes.");
+        static_assert(sizeof(std::atomic<generation_type>) ==
+                          sizeof(generation_type),
+                      "Atomics placed in shared memory must have the same "
+                      "layout as the underlying integer.");
+
+        /// @brief A single entry in the ring buffer, protected by a sequence
+        /// lock (seqlock) rather than a mutex.
+        ///
+        /// The generation counter is odd while the (single) writer is filling
+        /// the buffer, and even otherwise (0 meaning "never written"). Readers
+        /// copy the buffer out, then check that the generation didn't change
+        /// across the copy: they never block the writer, and a stalled or
+        /// crashed reader can't block anyone.
+        class ElementData : boost::noncopyable {
           public:
             typedef IPCRingBuffer::value_type BufferType;
+            typedef IPCRingBuffer::sequence_type sequence_type;
+
+            ElementData() : m_buf(nullptr), m_generation(0), m_seq(0) {}
+
+            BufferType *getBuf() const { return m_buf.get(); }
 
-            ElementData() : m_buf(nullptr) {}
+            /// @brief Writer: mark this element as being written, for the
+            /// given sequence number.
+            void beginWrite(sequence_type seq) {
+                auto gen = m_generation.load(std::memory_order_relaxed);
+                // Normally even here - but stay odd (while still changing) if
+                // a previous write was somehow never finished.
+                gen += (gen % 2 == 0) ? 1 : 2;
+                m_generation.store(gen, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                m_seq.store(seq, std::memory_order_relaxed);
+            }
 
-            template <typename LockType>
-            BufferType *getBuf(LockType &lock) const {
-                verifyReaderLock(lock);
-                return m_buf.get();
+            /// @brief Writer: mark this element as consistent again.
+            void endWrite() {
+                auto gen = m_generation.load(std::memory_order_relaxed);
+                m_generation.store(gen + 1, std::memory_order_release);
+            }
+
+            /// @brief Reader: copy the buffer out if it currently holds the
+            /// given sequence number and isn't modified while copying.
+            ///
+            /// @return true if @p dest now holds a consistent copy.
+            bool copyOut(sequence_type seq, BufferType *dest,
+                         std::size_t len) const {
+                auto gen = m_generation.load(std::memory_order_acquire);
+                if (gen == 0 || gen % 2 != 0 ||
+                    m_seq.load(std::memory_order_relaxed) != seq) {
+                    return false;
+                }
+                std::memcpy(dest, m_buf.get(), len);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return m_generation.load(std::memory_order_relaxed) == gen;
             }
 
             template <typename ManagedMemory>
@@ -74,9 +126,13 @@ namespace common {
 
           private:
             ipc_offset_ptr<BufferType> m_buf;
+            std::atomic<generation_type> m_generation;
+            std::atomic<sequence_type> m_seq;
         };
 
-        class Bookkeeping : public ipc::ObjectWithMutex, boost::noncopyable {
+        /// @brief The shared bookkeeping for the ring buffer. There must only
+        /// be a single writer (producer), but any number of readers.
+        class Bookkeeping : boost::noncopyable {
           public:
             typedef IPCRingBuffer::sequence_type sequence_type;
             typedef uint16_t raw_index_type;
@@ -110,34 +166,26 @@ namespace common {
                 : m_capacity(opts.getEntries()),
                   elementArray(shm.template construct<ElementData>(
                       bip::unique_instance)[m_capacity]()),
-                  m_beginSequenceNumber(0), m_nextSequenceNumber(0), m_begin(0),
-                  m_size(0), m_bufLen(opts.getEntrySize()) {
-
-                auto lock = getExclusiveLock();
-                {
-                    for (raw_index_type i = 0; i < m_capacity; ++i) {
-                        try {
-                            getByRawIndex(i, lock).allocateBuf(shm, opts);
-                        } catch (std::bad_alloc &) {
-                            OSVR_DEV_VERBOSE("Couldn't allocate buffer #"
-                                             << i
-                                             << ", truncating the ring buffer");
-                            m_capacity = i;
-                            break;
-                        }
+                  m_nextSequenceNumber(0), m_bufLen(opts.getEntrySize()) {
+                for (raw_index_type i = 0; i < m_capacity; ++i) {
+                    try {
+                        getByRawIndex(i).allocateBuf(shm, opts);
+                    } catch (std::bad_alloc &) {
+                        OSVR_DEV_VERBOSE("Couldn't allocate buffer #"
+                                         << i
+                                         << ", truncating the ring buffer");
+                        m_capacity = i;
+                        break;
                     }
                 }
             }
 
             template <typename ManagedMemory>
             void freeBufs(ManagedMemory &shm) {
-                auto lock = getExclusiveLock();
-                {
-                    for (raw_index_type i = 0; i < m_capacity; ++i) {
-                        getByRawIndex(i, lock).freeBuf(shm);
-                    }
-                    shm.template destroy<ElementData>(bip::unique_instance);
+                for (raw_index_type i = 0; i < m_capacity; ++i) {
+                    getByRawIndex(i).freeBuf(shm);
                 }
+                shm.template destroy<ElementData>(bip::unique_instance);
             }
 
             /// @brief Get number of elements.
@@ -146,74 +194,64 @@ namespace common {
             /// @brief Get capacity of elements.
             uint32_t getBufferLength() const { return m_bufLen; }
 
-            template <typename LockType>
-            ElementData &getByRawIndex(raw_index_type index, LockType &lock) {
-                verifyReaderLock(lock);
+            ElementData &getByRawIndex(raw_index_type index) {
                 return *(elementArray + (index % m_capacity));
             }
-            template <typename LockType>
-            ElementData *getBySequenceNumber(sequence_type num,
-                                             LockType &lock) {
-                verifyReaderLock(lock);
-                auto sequenceRelativeToBegin = num - m_beginSequenceNumber;
-                if (sequenceRelativeToBegin < m_size) {
-                    raw_index_type idx((m_begin + sequenceRelativeToBegin) %
-                                       m_capacity);
-                    return &getByRawIndex(idx, lock);
-                }
-                return nullptr; // out of bounds request -> nullptr return.
+            ElementData const &getByRawIndex(raw_index_type index) const {
+                return *(elementArray + (index % m_capacity));
             }
 
-            template <typename LockType> bool empty(LockType &lock) const {
-                verifyReaderLock(lock);
-                return m_size == 0;
+            /// @brief The element that does (or will) hold the given sequence
+            /// number.
+            ElementData const &getBySequenceNumber(sequence_type num) const {
+                return *(elementArray + (num % m_capacity));
             }
-            template <typename LockType>
-            sequence_type backSequenceNumber(LockType &lock) {
-                verifyReaderLock(lock);
-                return m_nextSequenceNumber - 1;
+
+            /// @brief The most recently published sequence number: if nothing
+            /// has been published yet, this refers to an element that has
+            /// never been written, so reading it will fail.
+            sequence_type backSequenceNumber() const {
+                return m_nextSequenceNumber.load(std::memory_order_acquire) -
+                       1;
             }
 
-            template <typename LockType> ElementData *back(LockType &lock) {
-                verifyReaderLock(lock);
-                if (empty(lock)) {
-                    return nullptr;
-                }
-                return &getByRawIndex(m_begin + m_size - 1, lock);
+            /// @brief Reader: copy out the element with the given sequence
+            /// number, if it's still available.
+            bool copyOut(sequence_type num, ElementData::BufferType *dest) const {
+                return getBySequenceNumber(num).copyOut(num, dest, m_bufLen);
             }
 
+            /// @brief Writer: start writing the next element. It becomes
+            /// visible to readers once the returned result is destroyed.
             IPCPutResultPtr produceElement() {
-                auto lock = getExclusiveLock();
-                auto sequenceNumber = m_nextSequenceNumber;
-                m_nextSequenceNumber++;
-                if (m_size == m_capacity) {
-                    m_begin++;
-                    m_beginSequenceNumber++;
-                } else {
-                    m_size++;
-                }
-#ifdef OSVR_SHM_LOCK_DEBUGGING
-                OSVR_DEV_VERBOSE(
-                    "Attempting to get an exclusive lock on sequence "
-                    << sequenceNumber << " aka index " << back(lock));
-#endif
-                auto elementLock = back(lock)->getExclusiveLock();
+                auto sequenceNumber =
+                    m_nextSequenceNumber.load(std::memory_order_relaxed);
+                auto &elt = *(elementArray + (sequenceNumber % m_capacity));
+                elt.beginWrite(sequenceNumber);
                 /// shared memory nullptr filled in by outer class
                 IPCPutResultPtr ret(new IPCPutResult{
-                    back(lock)->getBuf(elementLock), sequenceNumber,
-                    std::move(elementLock), std::move(lock), nullptr});
+                    elt.getBuf(), sequenceNumber, &elt, this, nullptr});
                 return ret;
             }
 
+            /// @brief Writer: finish writing an element and publish it.
+            void commitElement(ElementData &elt, sequence_type num) {
+                elt.endWrite();
+                m_nextSequenceNumber.store(num + 1, std::memory_order_release);
+            }
+
           private:
             raw_index_type m_capacity;
             ipc_offset_ptr<ElementData> elementArray;
-            IPCRingBuffer::sequence_type m_beginSequenceNumber;
-            IPCRingBuffer::sequence_type m_nextSequenceNumber;
-            raw_index_type m_begin;
-            raw_index_type m_size;
+            std::atomic<sequence_type> m_nextSequenceNumber;
             uint32_t m_bufLen;
         };
+
+        inline IPCPutResult::~IPCPutResult() {
+            if (bookkeeping) {
+                bookkeeping->commitElement(*element, seq);
+            }
+        }
     } // namespace detail
 
 } // namespace common
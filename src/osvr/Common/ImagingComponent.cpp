@@ -37,12 +37,48 @@
 // Standard includes
 #include <sstream>
 #include <utility>
+#include <algorithm>
+#include <limits>
 
 namespace osvr {
 namespace common {
     static inline uint32_t getBufferSize(OSVR_ImagingMetadata const &meta) {
         return meta.height * meta.width * meta.depth * meta.channels;
     }
+
+    /// @brief How often a client needing network frames repeats its request.
+    static const double NETWORK_REQUEST_REFRESH_SECONDS = 1.;
+    /// @brief How long a server keeps sending network frames after the last
+    /// request.
+    static const double NETWORK_REQUEST_LEASE_SECONDS = 3.;
+    /// @brief How long a client waits for frames through shared memory before
+    /// asking for them over the network.
+    static const double SHARED_MEMORY_GRACE_SECONDS = 1.;
+    /// @brief Maximum number of frames sent as deltas between full frames,
+    /// when compressing.
+    static const uint32_t KEYFRAME_INTERVAL = 30;
+    /// @brief Maximum image bytes per fragment, leaving room in a message for
+    /// the fragment header.
+    static const std::size_t MAX_FRAGMENT_BYTES =
+        vrpn_CONNECTION_TCP_BUFLEN - 1024;
+    /// @brief Largest decoded image accepted from the wire, so a corrupt or
+    /// hostile header can't make a client allocate without bound.
+    static const uint64_t MAX_RECEIVED_IMAGE_BYTES = 256 * 1024 * 1024;
+    /// @brief Largest sensor number accepted from the wire, for the same
+    /// reason.
+    static const OSVR_ChannelCount MAX_RECEIVED_SENSOR = 1023;
+
+    /// @brief Like getBufferSize(), but without the risk of overflow from
+    /// metadata not produced locally.
+    static inline uint64_t getBufferSize64(OSVR_ImagingMetadata const &meta) {
+        return uint64_t(meta.height) * meta.width * meta.depth * meta.channels;
+    }
+
+    static inline bool sameDimensions(OSVR_ImagingMetadata const &a,
+                                      OSVR_ImagingMetadata const &b) {
+        return a.width == b.width && a.height == b.height &&
+               a.channels == b.channels && a.depth == b.depth;
+    }
     namespace messages {
         namespace {
             template <typename T>
@@ -107,6 +143,115 @@ namespace common {
             return "com.osvr.imaging.imageregion";
         }
 
+        namespace {
+            struct ImageFragmentHeader {
+                OSVR_ImagingMetadata metadata;
+                OSVR_ChannelCount sensor;
+                /// @brief Frame number, per sensor.
+                uint32_t frame;
+                /// @brief For delta encoding, the frame number of the
+                /// reference frame.
+                uint32_t baseFrame;
+                ImageWireEncoding encoding;
+                /// @brief Total encoded bytes, across all fragments.
+                uint32_t encodedSize;
+                /// @brief Offset of this fragment's bytes in the encoded
+                /// frame.
+                uint32_t offset;
+                uint16_t fragment;
+                uint16_t fragmentCount;
+            };
+            template <typename T>
+            void process(ImageFragmentHeader &header, T &p) {
+                process(header.metadata, p);
+                p(header.sensor);
+                p(header.frame);
+                p(header.baseFrame);
+                p(header.encoding,
+                  serialization::EnumAsIntegerTag<ImageWireEncoding,
+                                                  uint8_t>());
+                p(header.encodedSize);
+                p(header.offset);
+                p(header.fragment);
+                p(header.fragmentCount);
+            }
+        } // namespace
+
+        class ImageFragment::MessageSerialization {
+          public:
+            MessageSerialization(ImageFragmentHeader const &header,
+                                 OSVR_ImageBufferElement *data, uint32_t len)
+                : m_header(header), m_data(data), m_length(len) {}
+
+            MessageSerialization() : m_data(nullptr), m_length(0) {}
+
+            template <typename T>
+            void allocateBuffer(T &, std::true_type const &) {
+                m_storage.resize(m_length);
+                m_data = m_storage.data();
+            }
+
+            template <typename T>
+            void allocateBuffer(T &, std::false_type const &) {
+                // Does nothing if we're serializing.
+            }
+
+            template <typename T> void processMessage(T &p) {
+                process(m_header, p);
+                p(m_length);
+                allocateBuffer(p, p.isDeserialize());
+                p(m_data, serialization::AlignedDataBufferTag(m_length, 1));
+            }
+
+            ImageFragmentHeader const &getHeader() const { return m_header; }
+            OSVR_ImageBufferElement const *getData() const { return m_data; }
+            uint32_t getLength() const { return m_length; }
+
+          private:
+            ImageFragmentHeader m_header;
+            OSVR_ImageBufferElement *m_data;
+            uint32_t m_length;
+            ImageBytes m_storage;
+        };
+
+        const char *ImageFragment::identifier() {
+            return "com.osvr.imaging.imagefragment";
+        }
+
+        namespace {
+            template <typename T>
+            void process(NetworkImagingOptions &options, T &p) {
+                p(options.roiX);
+                p(options.roiY);
+                p(options.roiWidth);
+                p(options.roiHeight);
+                p(options.downscale);
+                p(options.compress);
+            }
+        } // namespace
+
+        class NetworkStreamRequest::MessageSerialization {
+          public:
+            MessageSerialization() {}
+            explicit MessageSerialization(NetworkImagingOptions const &options)
+                : m_options(options) {}
+
+            template <typename T> void processMessage(T &p) {
+                process(m_options, p);
+            }
+
+            NetworkImagingOptions const &getOptions() const {
+                return m_options;
+            }
+
+          private:
+            NetworkImagingOptions m_options;
+        };
+
+        const char *NetworkStreamRequest::identifier() {
+            return "com.osvr.imaging.networkstreamrequest";
+        }
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         namespace {
             struct InProcessMemoryMessage {
@@ -201,7 +346,7 @@ namespace common {
         return ret;
     }
     ImagingComponent::ImagingComponent(OSVR_ChannelCount numChan)
-        : m_numSensor(numChan) {}
+        : m_numSensor(numChan), m_gotOne(false) {}
 
     void ImagingComponent::sendImageData(OSVR_ImagingMetadata metadata,
                                          OSVR_ImageBufferElement *imageData,
@@ -233,17 +378,23 @@ namespace common {
         auto imageBufferCopy = util::makeAlignedImageBuffer(imageBufferSize);
         memcpy(imageBufferCopy.get(), imageData, imageBufferSize);
 
+        m_sendInProcessBuffer(metadata, std::move(imageBufferCopy), sensor,
+                              timestamp);
+        return true;
+    }
+
+    void ImagingComponent::m_sendInProcessBuffer(
+        OSVR_ImagingMetadata metadata, util::AlignedImageBufferPtr &&buffer,
+        OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp) {
         Buffer<> buf;
         messages::ImagePlacedInProcessMemory::MessageSerialization
             serialization(messages::InProcessMemoryMessage{
                 metadata, sensor,
-                reinterpret_cast<intptr_t>(imageBufferCopy.release())});
+                reinterpret_cast<intptr_t>(buffer.release())});
 
         serialize(buf, serialization);
         m_getParent().packMessage(
             buf, imagePlacedInProcessMemory.getMessageType(), timestamp);
-
-        return true;
     }
 #endif
 
@@ -251,10 +402,21 @@ namespace common {
         OSVR_ImagingMetadata metadata, OSVR_ImageBufferElement *imageData,
         OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp) {
 
-        m_growShmVecIfRequired(sensor);
         uint32_t imageBufferSize = getBufferSize(metadata);
+        auto shm = m_ensureShmBuf(sensor, imageBufferSize);
+        if (!shm) {
+            return false;
+        }
+        auto seq = shm->put(imageData, imageBufferSize);
+        m_sendSharedMemoryNotice(metadata, *shm, seq, sensor, timestamp);
+        return true;
+    }
+
+    IPCRingBuffer *ImagingComponent::m_ensureShmBuf(OSVR_ChannelCount sensor,
+                                                    uint32_t entrySize) {
+        m_growShmVecIfRequired(sensor);
         if (!m_shmBuf[sensor] ||
-            m_shmBuf[sensor]->getEntrySize() != imageBufferSize) {
+            m_shmBuf[sensor]->getEntrySize() != entrySize) {
             // create or replace the shared memory ring buffer.
             auto makeName = [](OSVR_ChannelCount sensor,
                                std::string const &devName) {
@@ -265,16 +427,20 @@ namespace common {
             m_shmBuf[sensor] = IPCRingBuffer::create(
                 IPCRingBuffer::Options(
                     makeName(sensor, m_getParent().getDeviceName()))
-                    .setEntrySize(imageBufferSize));
+                    .setEntrySize(entrySize));
         }
         if (!m_shmBuf[sensor]) {
             OSVR_DEV_VERBOSE(
                 "Some issue creating shared memory for imaging, skipping out.");
-            return false;
+            return nullptr;
         }
-        auto &shm = *(m_shmBuf[sensor]);
-        auto seq = shm.put(imageData, imageBufferSize);
+        return m_shmBuf[sensor].get();
+    }
 
+    void ImagingComponent::m_sendSharedMemoryNotice(
+        OSVR_ImagingMetadata metadata, IPCRingBuffer &shm,
+        IPCRingBuffer::sequence_type seq, OSVR_ChannelCount sensor,
+        OSVR_TimeValue const &timestamp) {
         Buffer<> buf;
         messages::ImagePlacedInSharedMemory::MessageSerialization serialization(
             messages::SharedMemoryMessage{metadata, seq, sensor,
@@ -283,34 +449,297 @@ namespace common {
         serialize(buf, serialization);
         m_getParent().packMessage(
             buf, imagePlacedInSharedMemory.getMessageType(), timestamp);
+    }
+
+    OSVR_ImageBufferElement *
+    ImagingComponent::acquireImageBuffer(OSVR_ImagingMetadata const &metadata,
+                                         OSVR_ChannelCount sensor) {
+        if (m_pending.size() <= sensor) {
+            m_pending.resize(sensor + 1);
+        }
+        auto &pending = m_pending[sensor];
+        // Release anything left over from an acquire that was never committed
+        // first, since it may be the very ring buffer entry we'd get next.
+        pending.discard();
+        pending.metadata = metadata;
+        auto imageBufferSize = getBufferSize(metadata);
+
+#ifndef OSVR_COMMON_IN_PROCESS_IMAGING
+        auto shm = m_ensureShmBuf(sensor, imageBufferSize);
+        if (shm) {
+            pending.shmEntry.reset(
+                new IPCRingBuffer::BufferWriteProxy(shm->put()));
+            pending.buffer = pending.shmEntry->get();
+            return pending.buffer;
+        }
+#endif
+        // In-process imaging, or no shared memory available: lend an aligned
+        // buffer that (when possible) gets handed off rather than copied.
+        pending.ownedBuffer = util::makeAlignedImageBuffer(imageBufferSize);
+        pending.buffer = pending.ownedBuffer.get();
+        return pending.buffer;
+    }
+
+    bool ImagingComponent::commitImageBuffer(OSVR_ChannelCount sensor,
+                                             OSVR_TimeValue const &timestamp) {
+        if (m_pending.size() <= sensor || !m_pending[sensor].buffer) {
+            return false;
+        }
+        PendingImage pending(std::move(m_pending[sensor]));
+        m_pending[sensor] = PendingImage{};
 
+        util::Flag dataSent;
+        // Do this first, while we still hold the buffer.
+        dataSent += m_sendImageDataOnTheWire(pending.metadata, pending.buffer,
+                                             sensor, timestamp);
+        if (pending.shmEntry) {
+            auto seq = pending.shmEntry->getSequenceNumber();
+            // Release the write lock before telling anyone about the entry.
+            pending.shmEntry.reset();
+            m_sendSharedMemoryNotice(pending.metadata, *(m_shmBuf[sensor]),
+                                     seq, sensor, timestamp);
+            dataSent.set();
+        }
+#ifdef OSVR_COMMON_IN_PROCESS_IMAGING
+        if (pending.ownedBuffer) {
+            m_sendInProcessBuffer(pending.metadata,
+                                  std::move(pending.ownedBuffer), sensor,
+                                  timestamp);
+            dataSent.set();
+        }
+#endif
+        if (dataSent) {
+            m_checkFirst(pending.metadata);
+        }
         return true;
     }
 
+    void ImagingComponent::discardImageBuffer(OSVR_ChannelCount sensor) {
+        if (m_pending.size() > sensor) {
+            m_pending[sensor].discard();
+        }
+    }
+
     bool ImagingComponent::m_sendImageDataOnTheWire(
         OSVR_ImagingMetadata metadata, OSVR_ImageBufferElement *imageData,
         OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp) {
-        /// @todo currently only handle 8bit data over network
-        if (metadata.depth != 1) {
+        if (!m_networkStreamRequested()) {
             return false;
         }
-        Buffer<> buf;
-        messages::ImageRegion::MessageSerialization msg(metadata, imageData,
-                                                        sensor);
-        serialize(buf, msg);
-        if (buf.size() > vrpn_CONNECTION_TCP_BUFLEN) {
-#if 0
-            OSVR_DEV_VERBOSE("Skipping imaging message: size is "
-                             << buf.size() << " vs the maximum of "
-                             << vrpn_CONNECTION_TCP_BUFLEN);
-#endif
+        if (m_sent.size() <= sensor) {
+            m_sent.resize(sensor + 1);
+        }
+        auto &sent = m_sent[sensor];
+        auto regionMetadata = extractImageRegion(metadata, imageData,
+                                                 m_networkOptions, sent.region);
+
+        ImageBytes *payload = &sent.region;
+        auto encoding = ImageWireEncoding::Raw;
+        if (m_networkOptions.compress) {
+            auto keyframe = !sent.haveLast ||
+                            sent.sinceKeyframe >= KEYFRAME_INTERVAL ||
+                            !sameDimensions(sent.lastMetadata, regionMetadata);
+            encoding = encodeImageForWire(
+                sent.region, keyframe ? nullptr : &sent.last, sent.encoded);
+            payload = &sent.encoded;
+        }
+
+        auto fragmentCount =
+            std::max<std::size_t>(1, (payload->size() + MAX_FRAGMENT_BYTES - 1) /
+                                         MAX_FRAGMENT_BYTES);
+        if (fragmentCount > std::numeric_limits<uint16_t>::max()) {
+            OSVR_DEV_VERBOSE("Skipping imaging message: "
+                             << payload->size() << " bytes is too large");
             return false;
         }
-        m_getParent().packMessage(buf, imageRegion.getMessageType(), timestamp);
-        m_getParent().sendPending();
+
+        messages::ImageFragmentHeader header;
+        header.metadata = regionMetadata;
+        header.sensor = sensor;
+        header.baseFrame = sent.frame;
+        header.frame = ++sent.frame;
+        header.encoding = encoding;
+        header.encodedSize = static_cast<uint32_t>(payload->size());
+        header.fragmentCount = static_cast<uint16_t>(fragmentCount);
+        for (std::size_t i = 0; i < fragmentCount; ++i) {
+            auto offset = i * MAX_FRAGMENT_BYTES;
+            auto len = std::min(MAX_FRAGMENT_BYTES, payload->size() - offset);
+            header.offset = static_cast<uint32_t>(offset);
+            header.fragment = static_cast<uint16_t>(i);
+            Buffer<> buf;
+            messages::ImageFragment::MessageSerialization msg(
+                header, payload->data() + offset, static_cast<uint32_t>(len));
+            serialize(buf, msg);
+            m_getParent().packMessage(buf, imageFragment.getMessageType(),
+                                      timestamp);
+            m_getParent().sendPending();
+        }
+
+        if (m_networkOptions.compress) {
+            // Keep what we just sent as the reference for the next frame.
+            sent.sinceKeyframe = (encoding == ImageWireEncoding::DeltaRunLength)
+                                     ? sent.sinceKeyframe + 1
+                                     : 0;
+            sent.last.swap(sent.region);
+            sent.lastMetadata = regionMetadata;
+            sent.haveLast = true;
+        }
         return true;
     }
 
+    bool ImagingComponent::m_networkStreamRequested() const {
+        return m_networkRequested &&
+               util::time::duration(util::time::getNow(),
+                                    m_networkRequestReceived) <
+                   NETWORK_REQUEST_LEASE_SECONDS;
+    }
+
+    bool ImagingComponent::m_needNetworkStream(
+        util::time::TimeValue const &now) const {
+        return m_forceNetworkStream || m_sharedMemoryUnusable ||
+               util::time::duration(now, m_lastSharedMemoryActivity) >
+                   SHARED_MEMORY_GRACE_SECONDS;
+    }
+
+    void ImagingComponent::requestNetworkStream(
+        NetworkImagingOptions const &options) {
+        m_networkOptions = options;
+        m_forceNetworkStream = true;
+        m_networkRequestDirty = true;
+    }
+
+    void ImagingComponent::m_update() {
+        if (m_cb.empty()) {
+            // Only clients register image handlers.
+            return;
+        }
+        auto now = util::time::getNow();
+        if (!m_needNetworkStream(now)) {
+            return;
+        }
+        if (!m_networkRequestDirty &&
+            util::time::duration(now, m_networkRequestSent) <
+                NETWORK_REQUEST_REFRESH_SECONDS) {
+            return;
+        }
+        Buffer<> buf;
+        messages::NetworkStreamRequest::MessageSerialization msg(
+            m_networkOptions);
+        serialize(buf, msg);
+        m_getParent().packMessage(buf, networkStreamRequest.getMessageType());
+        m_networkRequestSent = now;
+        m_networkRequestDirty = false;
+    }
+
+    int VRPN_CALLBACK ImagingComponent::m_handleNetworkStreamRequest(
+        void *userdata, vrpn_HANDLERPARAM p) {
+        auto self = static_cast<ImagingComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+
+        messages::NetworkStreamRequest::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        if (!self->m_networkStreamRequested() ||
+            msg.getOptions() != self->m_networkOptions) {
+            // Start over with full frames for the new stream.
+            OSVR_DEV_VERBOSE("Network imaging stream requested");
+            self->m_networkOptions = msg.getOptions();
+            self->m_sent.clear();
+        }
+        self->m_networkRequested = true;
+        util::time::getNow(self->m_networkRequestReceived);
+        return 0;
+    }
+
+    int VRPN_CALLBACK ImagingComponent::m_handleImageFragment(
+        void *userdata, vrpn_HANDLERPARAM p) {
+        auto self = static_cast<ImagingComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+
+        messages::ImageFragment::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        auto const &header = msg.getHeader();
+        if (header.sensor > MAX_RECEIVED_SENSOR) {
+            OSVR_DEV_VERBOSE("Dropping image fragment for sensor "
+                             << header.sensor);
+            return 0;
+        }
+        if (self->m_received.size() <= header.sensor) {
+            self->m_received.resize(header.sensor + 1);
+        }
+        auto &received = self->m_received[header.sensor];
+
+        // Fragments of a frame arrive in order, so anything unexpected means
+        // we missed some: wait for the start of another frame.
+        if (header.fragment == 0) {
+            // Encoding never makes a frame larger than its raw size.
+            auto imageBytes = getBufferSize64(header.metadata);
+            if (imageBytes == 0 || imageBytes > MAX_RECEIVED_IMAGE_BYTES ||
+                header.encodedSize > imageBytes ||
+                header.fragmentCount == 0) {
+                OSVR_DEV_VERBOSE("Dropping image frame with bad sizes: "
+                                 << header.encodedSize << " bytes encoded, "
+                                 << imageBytes << " decoded");
+                received.assembling = false;
+                return 0;
+            }
+            received.assembling = true;
+            received.frame = header.frame;
+            received.metadata = header.metadata;
+            received.fragmentCount = header.fragmentCount;
+            received.fragmentsReceived = 0;
+            received.encoded.resize(header.encodedSize);
+        } else if (!received.assembling || received.frame != header.frame ||
+                   received.fragmentsReceived != header.fragment ||
+                   received.fragmentCount != header.fragmentCount ||
+                   received.encoded.size() != header.encodedSize ||
+                   !sameDimensions(received.metadata, header.metadata)) {
+            received.assembling = false;
+            return 0;
+        }
+        if (header.offset + msg.getLength() > received.encoded.size()) {
+            received.assembling = false;
+            return 0;
+        }
+        std::copy(msg.getData(), msg.getData() + msg.getLength(),
+                  received.encoded.begin() + header.offset);
+        ++received.fragmentsReceived;
+        if (received.fragmentsReceived < received.fragmentCount) {
+            return 0;
+        }
+        received.assembling = false;
+
+        auto haveBase =
+            received.haveLast && received.lastFrame == header.baseFrame;
+        received.decoded.resize(getBufferSize(received.metadata));
+        if (!decodeImageFromWire(header.encoding, received.encoded.data(),
+                                 received.encoded.size(),
+                                 haveBase ? &received.last : nullptr,
+                                 received.decoded)) {
+            // Likely a delta against a frame we never got: wait for the next
+            // keyframe.
+            received.haveLast = false;
+            return 0;
+        }
+        received.last.swap(received.decoded);
+        received.lastFrame = header.frame;
+        received.haveLast = true;
+
+        auto bytes = received.last.size();
+        auto buf = util::makeAlignedImageBuffer(bytes);
+        std::copy(received.last.begin(), received.last.end(), buf.get());
+        ImageData data;
+        data.sensor = header.sensor;
+        data.metadata = received.metadata;
+        data.buffer.reset(buf.release(), &util::alignedFree);
+        auto timestamp = util::time::fromStructTimeval(p.msg_time);
+
+        self->m_checkFirst(data.metadata);
+        for (auto const &cb : self->m_cb) {
+            cb(data, timestamp);
+        }
+        return 0;
+    }
+
     int VRPN_CALLBACK
     ImagingComponent::m_handleImageRegion(void *userdata, vrpn_HANDLERPARAM p) {
         auto self = static_cast<ImagingComponent *>(userdata);
@@ -345,6 +774,8 @@ namespace common {
             &util::alignedFree);
         auto timestamp = util::time::fromStructTimeval(p.msg_time);
 
+        // Frames are arriving locally, so no network stream is needed.
+        util::time::getNow(self->m_lastSharedMemoryActivity);
         self->m_checkFirst(msg.metadata);
         for (auto const &cb : self->m_cb) {
             cb(data, timestamp);
@@ -366,6 +797,7 @@ namespace common {
         if (IPCRingBuffer::getABILevel() != msg.abiLevel) {
             /// Can't interoperate with this server over shared memory
             OSVR_DEV_VERBOSE("Can't handle SHM ABI level " << msg.abiLevel);
+            self->m_sharedMemoryUnusable = true;
             return 0;
         }
         self->m_growShmVecIfRequired(msg.sensor);
@@ -385,12 +817,15 @@ namespace common {
             /// client
             OSVR_DEV_VERBOSE("Can't find desired IPC ring buffer "
                              << msg.shmName);
+            self->m_sharedMemoryUnusable = true;
             return 0;
         }
 
         auto &shm = self->m_shmBuf[msg.sensor];
         auto getResult = shm->get(msg.seqNum);
         if (getResult) {
+            self->m_sharedMemoryUnusable = false;
+            util::time::getNow(self->m_lastSharedMemoryActivity);
             auto bufptr = getResult.getBufferSmartPointer();
             self->m_checkFirst(msg.metadata);
             auto data = ImageData{msg.sensor, msg.metadata, bufptr};
@@ -404,9 +839,13 @@ namespace common {
 
     void ImagingComponent::registerImageHandler(ImageHandler handler) {
         if (m_cb.empty()) {
+            util::time::getNow(m_lastSharedMemoryActivity);
             m_registerHandler(&ImagingComponent::m_handleImageRegion, this,
                               imageRegion.getMessageType());
 
+            m_registerHandler(&ImagingComponent::m_handleImageFragment, this,
+                              imageFragment.getMessageType());
+
             m_registerHandler(
                 &ImagingComponent::m_handleImagePlacedInSharedMemory, this,
                 imagePlacedInSharedMemory.getMessageType());
@@ -421,6 +860,10 @@ namespace common {
     }
     void ImagingComponent::m_parentSet() {
         m_getParent().registerMessageType(imageRegion);
+        m_getParent().registerMessageType(imageFragment);
+        m_getParent().registerMessageType(networkStreamRequest);
+        m_registerHandler(&ImagingComponent::m_handleNetworkStreamRequest,
+                          this, networkStreamRequest.getMessageType());
         m_getParent().registerMessageType(imagePlacedInSharedMemory);
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         m_getParent().registerMessageType(imagePlacedInProcessMemory);
@@ -0,0 +1,209 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/ImagingWireFormat.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+
+namespace osvr {
+namespace common {
+    namespace {
+        /// @brief Run-length encoding in the style of PackBits: a header byte
+        /// h below 128 is followed by h + 1 literal bytes, while a header byte
+        /// of 128 or more is followed by one byte to repeat h - 125 times.
+        const std::size_t MAX_LITERAL = 128;
+        const std::size_t MIN_RUN = 3;
+        const std::size_t MAX_RUN = 130;
+        const OSVR_ImageBufferElement RUN_HEADER_BIAS = 125;
+
+        /// @brief Run-length encodes the @p len bytes returned by @p byteAt,
+        /// so the bytes need not be materialized first.
+        template <typename F>
+        inline void runLengthEncode(std::size_t len, F &&byteAt,
+                                    ImageBytes &out) {
+            out.clear();
+            std::size_t literalStart = 0;
+            auto flushLiterals = [&](std::size_t end) {
+                while (literalStart < end) {
+                    auto n = std::min(end - literalStart, MAX_LITERAL);
+                    out.push_back(static_cast<OSVR_ImageBufferElement>(n - 1));
+                    for (std::size_t j = 0; j < n; ++j) {
+                        out.push_back(byteAt(literalStart + j));
+                    }
+                    literalStart += n;
+                }
+            };
+            std::size_t i = 0;
+            while (i < len) {
+                auto val = byteAt(i);
+                std::size_t run = 1;
+                while (i + run < len && run < MAX_RUN &&
+                       byteAt(i + run) == val) {
+                    ++run;
+                }
+                if (run >= MIN_RUN) {
+                    flushLiterals(i);
+                    out.push_back(static_cast<OSVR_ImageBufferElement>(
+                        run + RUN_HEADER_BIAS));
+                    out.push_back(val);
+                    literalStart = i + run;
+                }
+                i += run;
+            }
+            flushLiterals(len);
+        }
+
+        /// @brief Decodes run-length encoded data to fill exactly the size of
+        /// @p out.
+        inline bool runLengthDecode(OSVR_ImageBufferElement const *data,
+                                    std::size_t len, ImageBytes &out) {
+            std::size_t pos = 0;
+            std::size_t i = 0;
+            while (i < len) {
+                std::size_t header = data[i++];
+                if (header < MAX_LITERAL) {
+                    auto n = header + 1;
+                    if (i + n > len || pos + n > out.size()) {
+                        return false;
+                    }
+                    std::copy(data + i, data + i + n, out.begin() + pos);
+                    i += n;
+                    pos += n;
+                } else {
+                    auto n = header - RUN_HEADER_BIAS;
+                    if (i >= len || pos + n > out.size()) {
+                        return false;
+                    }
+                    std::fill_n(out.begin() + pos, n, data[i]);
+                    ++i;
+                    pos += n;
+                }
+            }
+            return pos == out.size();
+        }
+    } // namespace
+
+    OSVR_ImagingMetadata
+    extractImageRegion(OSVR_ImagingMetadata const &metadata,
+                       OSVR_ImageBufferElement const *data,
+                       NetworkImagingOptions const &options, ImageBytes &out) {
+        auto x = std::min(options.roiX, metadata.width);
+        auto y = std::min(options.roiY, metadata.height);
+        auto w = metadata.width - x;
+        auto h = metadata.height - y;
+        if (options.roiWidth != 0) {
+            w = std::min(options.roiWidth, w);
+        }
+        if (options.roiHeight != 0) {
+            h = std::min(options.roiHeight, h);
+        }
+        if (w == 0 || h == 0) {
+            x = y = 0;
+            w = metadata.width;
+            h = metadata.height;
+        }
+        std::size_t step = std::max(options.downscale, uint8_t(1));
+
+        auto ret = metadata;
+        ret.width = static_cast<OSVR_ImageDimension>((w + step - 1) / step);
+        ret.height = static_cast<OSVR_ImageDimension>((h + step - 1) / step);
+
+        std::size_t pixelBytes = metadata.channels * metadata.depth;
+        std::size_t rowBytes = pixelBytes * metadata.width;
+        out.resize(pixelBytes * ret.width * ret.height);
+        auto dest = out.begin();
+        for (std::size_t row = 0; row < ret.height; ++row) {
+            auto src = data + (y + row * step) * rowBytes + x * pixelBytes;
+            if (step == 1) {
+                dest = std::copy(src, src + w * pixelBytes, dest);
+                continue;
+            }
+            for (std::size_t col = 0; col < ret.width; ++col) {
+                dest = std::copy(src, src + pixelBytes, dest);
+                src += step * pixelBytes;
+            }
+        }
+        return ret;
+    }
+
+    ImageWireEncoding encodeImageForWire(ImageBytes const &image,
+                                         ImageBytes const *previous,
+                                         ImageBytes &out) {
+        if (previous && previous->size() == image.size()) {
+            auto const &prev = *previous;
+            runLengthEncode(image.size(),
+                            [&](std::size_t i) {
+                                return static_cast<OSVR_ImageBufferElement>(
+                                    image[i] - prev[i]);
+                            },
+                            out);
+            if (out.size() < image.size()) {
+                return ImageWireEncoding::DeltaRunLength;
+            }
+        } else {
+            runLengthEncode(image.size(),
+                            [&](std::size_t i) { return image[i]; }, out);
+            if (out.size() < image.size()) {
+                return ImageWireEncoding::RunLength;
+            }
+        }
+        out = image;
+        return ImageWireEncoding::Raw;
+    }
+
+    bool decodeImageFromWire(ImageWireEncoding encoding,
+                             OSVR_ImageBufferElement const *data,
+                             std::size_t len, ImageBytes const *previous,
+                             ImageBytes &out) {
+        switch (encoding) {
+        case ImageWireEncoding::Raw:
+            if (len != out.size()) {
+                return false;
+            }
+            std::copy(data, data + len, out.begin());
+            return true;
+        case ImageWireEncoding::RunLength:
+            return runLengthDecode(data, len, out);
+        case ImageWireEncoding::DeltaRunLength: {
+            if (!previous || previous->size() != out.size() ||
+                !runLengthDecode(data, len, out)) {
+                return false;
+            }
+            auto const &prev = *previous;
+            for (std::size_t i = 0, e = out.size(); i < e; ++i) {
+                out[i] = static_cast<OSVR_ImageBufferElement>(out[i] + prev[i]);
+            }
+            return true;
+        }
+        }
+        return false;
+    }
+
+} // namespace common
+} // namespace osvr
@@ -0,0 +1,114 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/InProcessReports.h>
+
+// Library/third-party includes
+#include <boost/assert.hpp>
+
+// Standard includes
+#include <algorithm>
+
+namespace osvr {
+namespace common {
+    TrackerReportListener::~TrackerReportListener() {}
+
+    void InProcessTrackerChannel::attachPublisher() { ++m_publishers; }
+
+    void InProcessTrackerChannel::detachPublisher() {
+        BOOST_ASSERT_MSG(m_publishers > 0,
+                         "Detaching a publisher that was never attached!");
+        --m_publishers;
+    }
+
+    template <typename F>
+    void InProcessTrackerChannel::m_forEachListener(F &&f) {
+        ++m_publishDepth;
+        // Index, since a listener added meanwhile may reallocate the vector.
+        for (std::size_t i = 0; i < m_listeners.size(); ++i) {
+            if (m_listeners[i]) {
+                f(*m_listeners[i]);
+            }
+        }
+        --m_publishDepth;
+        if (0 == m_publishDepth) {
+            m_listeners.erase(std::remove(begin(m_listeners), end(m_listeners),
+                                          nullptr),
+                              end(m_listeners));
+        }
+    }
+
+    void InProcessTrackerChannel::publishPose(
+        OSVR_ChannelCount sensor, OSVR_PoseState const &pose,
+        util::time::TimeValue const &timestamp) {
+        m_forEachListener([&](TrackerReportListener &listener) {
+            listener.handlePose(sensor, pose, timestamp);
+        });
+    }
+
+    void InProcessTrackerChannel::publishVelocity(
+        OSVR_ChannelCount sensor, OSVR_VelocityState const &vel,
+        util::time::TimeValue const &timestamp) {
+        m_forEachListener([&](TrackerReportListener &listener) {
+            listener.handleVelocity(sensor, vel, timestamp);
+        });
+    }
+
+    void InProcessTrackerChannel::publishAcceleration(
+        OSVR_ChannelCount sensor, OSVR_AccelerationState const &accel,
+        util::time::TimeValue const &timestamp) {
+        m_forEachListener([&](TrackerReportListener &listener) {
+            listener.handleAcceleration(sensor, accel, timestamp);
+        });
+    }
+
+    void InProcessTrackerChannel::addListener(TrackerReportListener &listener) {
+        m_listeners.push_back(&listener);
+    }
+
+    void
+    InProcessTrackerChannel::removeListener(TrackerReportListener &listener) {
+        if (m_publishDepth > 0) {
+            // Someone's iterating: leave a hole, filled in once they're done.
+            std::replace(begin(m_listeners), end(m_listeners), &listener,
+                         static_cast<TrackerReportListener *>(nullptr));
+            return;
+        }
+        m_listeners.erase(
+            std::remove(begin(m_listeners), end(m_listeners), &listener),
+            end(m_listeners));
+    }
+
+    InProcessTrackerChannel &
+    InProcessReports::getTrackerChannel(std::string const &deviceName) {
+        auto &channel = m_trackers[deviceName];
+        if (!channel) {
+            channel.reset(new InProcessTrackerChannel);
+        }
+        return *channel;
+    }
+
+} // namespace common
+} // namespace osvr
@@ -32,9 +32,6 @@
 
 // Library/third-party includes
 #include <boost/assert.hpp>
-#include <boost/algorithm/string/find_iterator.hpp>
-#include <boost/algorithm/string/finder.hpp>
-#include <boost/range/adaptor/sliced.hpp>
 
 // Standard includes
 #include <string>
@@ -92,51 +89,48 @@ namespace common {
                 path.pop_back();
             }
 
-            // new scope for the iterators and loop:
-            {
-                // Create a boost string algorithm "split iterator" to iterate
-                // through components of the path.
-                auto begin = boost::algorithm::make_split_iterator(
-                    path,
-                    boost::first_finder(getPathSeparator(), boost::is_equal()));
-                // Create the corresponding end iterator: same type as begin,
-                // but default constructed.
-                auto end = decltype(begin)();
-
-                // Temporary string that will be re-used each pass through the
-                // loop
-                std::string component;
-
-                // Use the iterators as a range in a loop, to process each
-                // component of the path
-                for (auto rangeIt : boost::make_iterator_range(begin, end)) {
-                    // Extract the component to a string for interpretation.
-                    component = boost::copy_range<std::string>(rangeIt);
-
-                    // Interpret the component: four cases
-                    if (component.empty()) {
-                        // Empty components are forbidden
-                        throw exceptions::EmptyPathComponent(path);
-                    } else if (component == ".") {
-                        // current location - go to the next component without
-                        // changing location
-                        continue;
-                    } else if (component == "..") {
-                        // parent path - must check for permission first, then
-                        // possibility (root has no parent)
-                        if (GETPARENT_PERMIT != permitParent) {
-                            throw exceptions::ForbiddenParentPath();
-                        }
-                        if (ret->isRoot()) {
-                            throw exceptions::ImpossibleParentPath();
-                        }
-                        ret = ret->getParent();
-                    } else {
-                        // A non-special string: just get the child
-                        ret = f(ret, component);
+            // Temporary string that will be re-used each pass through the
+            // loop
+            std::string component;
+
+            // Walk through the components of the path, separated by the path
+            // separator.
+            std::string::size_type componentBegin = 0;
+            while (componentBegin <= path.size()) {
+                auto componentEnd =
+                    path.find(getPathSeparatorCharacter(), componentBegin);
+                if (componentEnd == std::string::npos) {
+                    componentEnd = path.size();
+                }
+                // Extract the component to a string for interpretation,
+                // re-using the string's buffer.
+                component.assign(path, componentBegin,
+                                 componentEnd - componentBegin);
+                componentBegin = componentEnd + 1;
+
+                // Interpret the component: four cases
+                if (component.empty()) {
+                    // Empty components are forbidden
+                    throw exceptions::EmptyPathComponent(path);
+                } else if (component == ".") {
+                    // current location - go to the next component without
+                    // changing location
+                    continue;
+                } else if (component == "..") {
+                    // parent path - must check for permission first, then
+                    // possibility (root has no parent)
+                    if (GETPARENT_PERMIT != permitParent) {
+                        throw exceptions::ForbiddenParentPath();
+                    }
+                    if (ret->isRoot()) {
+                        throw exceptions::ImpossibleParentPath();
                     }
-                    // if we make it to here we've updated ret.
+                    ret = ret->getParent();
+                } else {
+                    // A non-special string: just get the child
+                    ret = f(ret, component);
                 }
+                // if we make it to here we've updated ret.
             }
 
             return *ret;
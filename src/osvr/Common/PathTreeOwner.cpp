@@ -26,6 +26,7 @@
 #include <osvr/Common/PathTreeOwner.h>
 #include <osvr/Common/PathTreeObserver.h>
 #include <osvr/Common/PathTreeSerialization.h>
+#include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
 // - none
@@ -33,6 +34,7 @@
 // Standard includes
 #include <algorithm>
 #include <iterator>
+#include <utility>
 
 namespace osvr {
 namespace common {
@@ -82,11 +84,67 @@ namespace common {
         common::jsonToPathTree(m_tree, nodes);
 
         m_valid = true;
+        ++m_generation;
+        m_lastDeltaPaths.clear();
+        // A full tree's version is unknown until the server stamps it.
+        m_versionKnown = false;
 
         for_each_cleanup_pointers(
             m_observers, [&](PathTreeObserver const &observer) {
                 observer.notifyEvent(PathTreeEvents::AfterUpdate, m_tree);
             });
     }
+
+    bool PathTreeOwner::applyTreeDelta(Json::Value const &delta) {
+        if (!delta.isMember("version")) {
+            return false;
+        }
+        auto version = delta["version"].asUInt64();
+        auto upToDate = m_valid && m_versionKnown && m_version == version;
+        if (delta.isMember("nodes")) {
+            // Full tree, sent because some client asked for one.
+            if (!upToDate) {
+                replaceTree(delta["nodes"]);
+                m_version = version;
+                m_versionKnown = true;
+            }
+            return true;
+        }
+        if (!delta.isMember("baseVersion")) {
+            // Just a version stamp: all we can do is check it.
+            return upToDate;
+        }
+        if (!m_valid || !m_versionKnown ||
+            delta["baseVersion"].asUInt64() != m_version) {
+            OSVR_DEV_VERBOSE("Ignoring path tree delta for a tree version we "
+                             "don't have.");
+            m_versionKnown = false;
+            return false;
+        }
+
+        for_each_cleanup_pointers(
+            m_observers, [&](PathTreeObserver const &observer) {
+                observer.notifyEvent(PathTreeEvents::AboutToUpdate, m_tree);
+            });
+
+        auto pruned = common::applyPathTreeDelta(m_tree, delta);
+        m_version = version;
+        m_lastDeltaPaths = std::move(pruned);
+        for (auto const &node : delta["added"]) {
+            m_lastDeltaPaths.push_back(node["path"].asString());
+        }
+        for (auto const &node : delta["changed"]) {
+            m_lastDeltaPaths.push_back(node["path"].asString());
+        }
+        for (auto const &path : delta["removed"]) {
+            m_lastDeltaPaths.push_back(path.asString());
+        }
+
+        for_each_cleanup_pointers(
+            m_observers, [&](PathTreeObserver const &observer) {
+                observer.notifyEvent(PathTreeEvents::AfterUpdate, m_tree);
+            });
+        return true;
+    }
 } // namespace common
 } // namespace osvr
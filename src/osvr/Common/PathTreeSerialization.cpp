@@ -35,7 +35,10 @@
 #include <json/value.h>
 
 // Standard includes
-// - none
+#include <unordered_map>
+#include <algorithm>
+#include <vector>
+#include <string>
 
 namespace osvr {
 namespace common {
@@ -101,5 +104,99 @@ namespace common {
             tree.getNodeByPath(node["path"].asString()).value() = elt;
         }
     }
+
+    static const char DELTA_ADDED_KEY[] = "added";
+    static const char DELTA_CHANGED_KEY[] = "changed";
+    static const char DELTA_REMOVED_KEY[] = "removed";
+
+    Json::Value diffPathTreeJson(Json::Value const &oldNodes,
+                                 Json::Value const &newNodes) {
+        Json::Value ret(Json::objectValue);
+        auto &added = ret[DELTA_ADDED_KEY] = Json::arrayValue;
+        auto &changed = ret[DELTA_CHANGED_KEY] = Json::arrayValue;
+        auto &removed = ret[DELTA_REMOVED_KEY] = Json::arrayValue;
+
+        // Both arrays come from traversing trees, so they usually share a
+        // long common prefix of paths: compare that pairwise first.
+        Json::ArrayIndex prefix = 0;
+        auto const prefixMax = std::min(oldNodes.size(), newNodes.size());
+        for (; prefix < prefixMax; ++prefix) {
+            auto const &oldNode = oldNodes[prefix];
+            auto const &newNode = newNodes[prefix];
+            if (oldNode["path"] != newNode["path"]) {
+                break;
+            }
+            if (oldNode != newNode) {
+                changed.append(newNode);
+            }
+        }
+
+        // Index the rest of the old nodes by path; entries are erased as
+        // they're matched so that whatever remains at the end was removed.
+        std::unordered_map<std::string, Json::Value const *> oldByPath;
+        oldByPath.reserve(oldNodes.size() - prefix);
+        for (auto i = prefix; i < oldNodes.size(); ++i) {
+            oldByPath[oldNodes[i]["path"].asString()] = &oldNodes[i];
+        }
+        for (auto i = prefix; i < newNodes.size(); ++i) {
+            auto const &node = newNodes[i];
+            auto it = oldByPath.find(node["path"].asString());
+            if (it == end(oldByPath)) {
+                added.append(node);
+                continue;
+            }
+            if (*it->second != node) {
+                changed.append(node);
+            }
+            oldByPath.erase(it);
+        }
+        // Report removals in the old tree's order, for determinism.
+        for (auto i = prefix; i < oldNodes.size(); ++i) {
+            auto path = oldNodes[i]["path"].asString();
+            if (oldByPath.find(path) != end(oldByPath)) {
+                removed.append(path);
+            }
+        }
+        return ret;
+    }
+
+    bool isPathTreeDeltaEmpty(Json::Value const &delta) {
+        return delta[DELTA_ADDED_KEY].empty() &&
+               delta[DELTA_CHANGED_KEY].empty() &&
+               delta[DELTA_REMOVED_KEY].empty();
+    }
+
+    std::vector<std::string> applyPathTreeDelta(PathTree &tree,
+                                                Json::Value const &delta) {
+        std::vector<std::string> pruned;
+        // Removals first: a path can't be both removed and added in one
+        // delta, but this order is the safe one if it ever were. Longest
+        // paths first, so removed subtrees are pruned from the leaves up.
+        std::vector<std::string> removed;
+        for (auto const &path : delta[DELTA_REMOVED_KEY]) {
+            removed.push_back(path.asString());
+        }
+        std::sort(begin(removed), end(removed),
+                  [](std::string const &a, std::string const &b) {
+                      return a.size() > b.size();
+                  });
+        for (auto const &path : removed) {
+            auto node = &tree.getNodeByPath(path);
+            node->value() = elements::NullElement();
+            // Prune the node, along with any ancestors it leaves null and
+            // childless, since a full tree wouldn't have them either.
+            while (!node->isRoot() && !node->hasChildren() &&
+                   elements::isNull(node->value())) {
+                auto parent = node->getParent();
+                auto name = node->getName();
+                pruned.push_back(getFullPath(*node));
+                parent->removeChildByName(name);
+                node = parent;
+            }
+        }
+        jsonToPathTree(tree, delta[DELTA_ADDED_KEY]);
+        jsonToPathTree(tree, delta[DELTA_CHANGED_KEY]);
+        return pruned;
+    }
 } // namespace common
-} // namespace osvr
\ No newline at end of file
+} // namespace osvr
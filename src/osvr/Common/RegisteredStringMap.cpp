@@ -30,11 +30,15 @@
 #include <boost/algorithm/string.hpp>
 
 // Standard includes
+#include <functional>
 #include <iostream>
 
 namespace osvr {
 namespace common {
 
+    /// @brief Initial number of hash index slots: must be a power of two.
+    static const std::size_t INITIAL_INDEX_SIZE = 64;
+
     /// @brief helper function to print size and contents of the map
     void RegisteredStringMap::printCurrentMap() {
         auto n = m_regEntries.size();
@@ -47,20 +51,56 @@ namespace common {
     }
 
     util::StringID RegisteredStringMap::getStringID(std::string const &str) {
-        auto entry = std::find(begin(m_regEntries), end(m_regEntries), str);
-        if (end(m_regEntries) != entry) {
+        // Keep the index at most half full, so probe sequences stay short.
+        if ((m_regEntries.size() + 1) * 2 > m_index.size()) {
+            m_growIndex();
+        }
+        auto hash = std::hash<std::string>()(str);
+        auto slot = m_findSlot(hash, str);
+        if (m_index[slot] != 0) {
             // we found it.
-            return util::StringID(std::distance(begin(m_regEntries), entry));
+            return util::StringID(m_index[slot] - 1);
         }
 
         // we didn't find an entry in the registry so we'll add a new one
         auto ret = util::StringID(
             m_regEntries.size()); // will be the location of the next insert.
         m_regEntries.push_back(str);
+        m_hashes.push_back(hash);
+        m_index[slot] = ret.value() + 1;
         m_modified = true;
         return ret;
     }
 
+    std::size_t RegisteredStringMap::m_findSlot(std::size_t hash,
+                                                std::string const &str) const {
+        auto mask = m_index.size() - 1;
+        auto slot = hash & mask;
+        while (m_index[slot] != 0) {
+            auto entry = m_index[slot] - 1;
+            if (m_hashes[entry] == hash && m_regEntries[entry] == str) {
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void RegisteredStringMap::m_growIndex() {
+        auto newSize =
+            m_index.empty() ? INITIAL_INDEX_SIZE : m_index.size() * 2;
+        m_index.assign(newSize, 0);
+        auto mask = newSize - 1;
+        auto n = m_regEntries.size();
+        for (decltype(n) i = 0; i < n; ++i) {
+            auto slot = m_hashes[i] & mask;
+            while (m_index[slot] != 0) {
+                slot = (slot + 1) & mask;
+            }
+            m_index[slot] = static_cast<uint32_t>(i + 1);
+        }
+    }
+
     std::string RegisteredStringMap::getStringFromId(util::StringID id) const {
 
         // requested non-existent ID (include sanity check)
@@ -102,6 +142,7 @@ namespace common {
         std::vector<std::string> const &peerEntries) {
         m_remoteToLocal.clear();
         auto n = peerEntries.size();
+        m_remoteToLocal.reserve(n);
         for (uint32_t i = 0; i < n; ++i) {
             m_remoteToLocal.push_back(
                 m_local.getStringID(peerEntries[i]).value());
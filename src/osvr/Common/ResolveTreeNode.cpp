@@ -71,15 +71,17 @@ namespace common {
 
     // Forward declaration
     void resolveTreeNodeImpl(PathTree &pathTree, std::string const &path,
-                             OriginalSource &source);
+                             OriginalSource &source,
+                             std::vector<std::string> *dependencies);
 
     class TreeResolutionVisitor : public boost::static_visitor<>,
                                   boost::noncopyable {
       public:
         TreeResolutionVisitor(common::PathTree &tree, common::PathNode &node,
-                              common::OriginalSource &source)
+                              common::OriginalSource &source,
+                              std::vector<std::string> *dependencies)
             : boost::static_visitor<>(), m_tree(tree), m_node(node),
-              m_source(source) {}
+              m_source(source), m_dependencies(dependencies) {}
 
         /// @brief Fallback case
         template <typename T> void operator()(T const &) {
@@ -125,31 +127,47 @@ namespace common {
       private:
         void m_decompose() { m_source.decompose(m_node); }
         void m_recurse(std::string const &path) {
-            resolveTreeNodeImpl(m_tree, path, m_source);
+            resolveTreeNodeImpl(m_tree, path, m_source, m_dependencies);
         }
         PathTree &m_getPathTree() { return m_tree; }
 
         PathTree &m_tree;
         PathNode &m_node;
         OriginalSource &m_source;
+        std::vector<std::string> *m_dependencies;
     };
 
     inline void resolveTreeNodeImpl(PathTree &pathTree, std::string const &path,
-                                    OriginalSource &source) {
+                                    OriginalSource &source,
+                                    std::vector<std::string> *dependencies) {
         auto &node = pathTree.getNodeByPath(path);
+        if (dependencies) {
+            dependencies->push_back(getFullPath(node));
+        }
 
         // First do any inference possible here.
         ifNullTryInferFromParent(node);
 
         // Now visit.
-        TreeResolutionVisitor visitor(pathTree, node, source);
+        TreeResolutionVisitor visitor(pathTree, node, source, dependencies);
         boost::apply_visitor(visitor, node.value());
     }
 
     boost::optional<OriginalSource> resolveTreeNode(PathTree &pathTree,
                                                     std::string const &path) {
         OriginalSource source;
-        resolveTreeNodeImpl(pathTree, path, source);
+        resolveTreeNodeImpl(pathTree, path, source, nullptr);
+        if (source.isResolved()) {
+            return source;
+        }
+        return boost::optional<OriginalSource>();
+    }
+
+    boost::optional<OriginalSource>
+    resolveTreeNode(PathTree &pathTree, std::string const &path,
+                    std::vector<std::string> &dependencies) {
+        OriginalSource source;
+        resolveTreeNodeImpl(pathTree, path, source, &dependencies);
         if (source.isResolved()) {
             return source;
         }
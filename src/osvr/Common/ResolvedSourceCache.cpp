@@ -0,0 +1,87 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// 	http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/ResolvedSourceCache.h>
+#include <osvr/Common/ResolveTreeNode.h>
+#include <osvr/Common/RoutingConstants.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    boost::optional<OriginalSource> const &
+    ResolvedSourceCache::resolve(PathTree &tree, std::string const &path) {
+        auto it = m_entries.find(path);
+        if (it != end(m_entries)) {
+            return it->second.source;
+        }
+
+        Entry entry;
+        entry.source = resolveTreeNode(tree, path, entry.dependencies);
+
+        // Record this path as a dependent of each dependency and all of its
+        // ancestors: a device or interface, found by walking up from where
+        // the resolution landed, is always an ancestor of the last
+        // dependency.
+        for (auto const &dep : entry.dependencies) {
+            auto pos = dep.size();
+            while (pos > 0) {
+                m_dependents[dep.substr(0, pos)].insert(path);
+                pos = dep.rfind(getPathSeparatorCharacter(), pos - 1);
+                if (pos == std::string::npos) {
+                    break;
+                }
+            }
+        }
+        return m_entries.emplace(path, std::move(entry)).first->second.source;
+    }
+
+    bool ResolvedSourceCache::contains(std::string const &path) const {
+        return m_entries.find(path) != end(m_entries);
+    }
+
+    void ResolvedSourceCache::clear() {
+        m_entries.clear();
+        m_dependents.clear();
+    }
+
+    std::size_t ResolvedSourceCache::invalidate(std::string const &path) {
+        auto it = m_dependents.find(path);
+        if (it == end(m_dependents)) {
+            return 0;
+        }
+        std::size_t ret = 0;
+        for (auto const &dependent : it->second) {
+            ret += m_entries.erase(dependent);
+        }
+        m_dependents.erase(it);
+        return ret;
+    }
+} // namespace common
+} // namespace osvr
@@ -93,6 +93,28 @@ namespace common {
         const char *ReplacementTreeFromServer::identifier() {
             return "com.osvr.system.ReplacementTreeFromServer";
         }
+
+        class TreeDeltaFromServer::MessageSerialization {
+          public:
+            MessageSerialization(Json::Value const &msg = Json::objectValue)
+                : m_msg(msg) {}
+
+            template <typename T> void processMessage(T &p) {
+                p(m_msg, serialization::JsonOnlyMessageTag());
+            }
+
+            Json::Value const &getValue() const { return m_msg; }
+
+          private:
+            Json::Value m_msg;
+        };
+        const char *TreeDeltaFromServer::identifier() {
+            return "com.osvr.system.TreeDeltaFromServer";
+        }
+
+        const char *TreeRequestToServer::identifier() {
+            return "com.osvr.system.TreeRequestToServer";
+        }
     } // namespace messages
 
     const char *SystemComponent::deviceName() {
@@ -131,9 +153,12 @@ namespace common {
     }
 
     void SystemComponent::sendReplacementTree(PathTree &tree) {
-        auto config = pathTreeToJson(tree);
+        sendReplacementTree(pathTreeToJson(tree));
+    }
+
+    void SystemComponent::sendReplacementTree(Json::Value const &nodes) {
         Buffer<> buf;
-        messages::ReplacementTreeFromServer::MessageSerialization msg(config);
+        messages::ReplacementTreeFromServer::MessageSerialization msg(nodes);
         serialize(buf, msg);
         m_getParent().packMessage(buf, treeOut.getMessageType());
 
@@ -148,11 +173,45 @@ namespace common {
         m_replaceTreeHandlers.push_back(cb);
     }
 
+    void SystemComponent::sendTreeDelta(Json::Value const &delta) {
+        Buffer<> buf;
+        messages::TreeDeltaFromServer::MessageSerialization msg(delta);
+        serialize(buf, msg);
+        m_getParent().packMessage(buf, treeDeltaOut.getMessageType());
+
+        m_getParent().sendPending(); // same reasoning as the full tree
+    }
+
+    void SystemComponent::registerTreeDeltaHandler(JsonHandler cb) {
+        if (m_treeDeltaHandlers.empty()) {
+            m_registerHandler(&SystemComponent::m_handleTreeDelta, this,
+                              treeDeltaOut.getMessageType());
+        }
+        m_treeDeltaHandlers.push_back(cb);
+    }
+
+    void SystemComponent::sendTreeRequest() {
+        Buffer<> buf;
+        m_getParent().packMessage(buf, treeRequestIn.getMessageType());
+        m_getParent().sendPending();
+    }
+
+    void SystemComponent::registerTreeRequestHandler(
+        TreeRequestHandler const &cb) {
+        if (m_treeRequestHandlers.empty()) {
+            m_registerHandler(&SystemComponent::m_handleTreeRequest, this,
+                              treeRequestIn.getMessageType());
+        }
+        m_treeRequestHandlers.push_back(cb);
+    }
+
     void SystemComponent::m_parentSet() {
         m_getParent().registerMessageType(routesOut);
         m_getParent().registerMessageType(appStartup);
         m_getParent().registerMessageType(routeIn);
         m_getParent().registerMessageType(treeOut);
+        m_getParent().registerMessageType(treeDeltaOut);
+        m_getParent().registerMessageType(treeRequestIn);
     }
 
     int SystemComponent::m_handleReplaceTree(void *userdata,
@@ -169,5 +228,29 @@ namespace common {
         }
         return 0;
     }
+
+    int SystemComponent::m_handleTreeDelta(void *userdata,
+                                           vrpn_HANDLERPARAM p) {
+        auto self = static_cast<SystemComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+        messages::TreeDeltaFromServer::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        auto timestamp = util::time::fromStructTimeval(p.msg_time);
+        BOOST_ASSERT_MSG(msg.getValue().isObject(),
+                         "tree delta message must be an object!");
+        for (auto const &cb : self->m_treeDeltaHandlers) {
+            cb(msg.getValue(), timestamp);
+        }
+        return 0;
+    }
+
+    int SystemComponent::m_handleTreeRequest(void *userdata,
+                                             vrpn_HANDLERPARAM) {
+        auto self = static_cast<SystemComponent *>(userdata);
+        for (auto const &cb : self->m_treeRequestHandlers) {
+            cb();
+        }
+        return 0;
+    }
 } // namespace common
 } // namespace osvr
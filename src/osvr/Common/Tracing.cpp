@@ -34,6 +34,16 @@
 
 // Standard includes
 #include <sstream>
+#if OSVR_COMMON_TRACING_CHROME
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include <unistd.h>
+#endif
 
 namespace osvr {
 namespace common {
@@ -57,6 +67,225 @@ namespace common {
         }
 
         void WorkerTracePolicy::mark(const char *text) { ETWWorkerMark(text); }
+#elif OSVR_COMMON_TRACING_CHROME
+        namespace {
+            /// @brief A single recorded event: either a complete region
+            /// ('X') or an instant mark ('i').
+            struct TraceEvent {
+                std::int64_t start;
+                std::int64_t duration;
+                char phase;
+                bool worker;
+                /// Copied, since marks are often built from temporaries.
+                char name[64];
+            };
+            /// @brief Number of events a thread buffers before handing them
+            /// off to be written.
+            static const std::size_t EVENTS_PER_FLUSH = 4096;
+
+            /// @brief Process-wide destination of the trace events: a file
+            /// in the Chrome trace event JSON (array) format.
+            ///
+            /// Only touched when a thread flushes its buffer, so the mutex
+            /// is never taken on the path that records an event.
+            /// Deliberately leaked, and finished by an atexit handler, so
+            /// that late-exiting threads never flush into a destroyed
+            /// object.
+            class TraceSink {
+              public:
+                static TraceSink &instance() {
+                    static TraceSink *sink = new TraceSink;
+                    return *sink;
+                }
+
+                /// @brief Microseconds since the sink was created.
+                std::int64_t now() const {
+                    return std::chrono::duration_cast<
+                               std::chrono::microseconds>(
+                               std::chrono::steady_clock::now() - m_epoch)
+                        .count();
+                }
+
+                std::uint32_t registerThread() { return ++m_threads; }
+
+                void write(std::uint32_t tid,
+                           std::vector<TraceEvent> const &events) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_finished || !m_ensureOpen()) {
+                        return;
+                    }
+                    for (auto const &e : events) {
+                        std::fputs(m_first ? "\n" : ",\n", m_file);
+                        m_first = false;
+                        std::fputs("{\"name\":\"", m_file);
+                        m_writeEscaped(e.name);
+                        std::fprintf(
+                            m_file, "\",\"cat\":\"%s\",\"ph\":\"%c\","
+                                    "\"ts\":%lld,\"pid\":%ld,\"tid\":%lu",
+                            e.worker ? "worker" : "main", e.phase,
+                            static_cast<long long>(e.start), m_pid,
+                            static_cast<unsigned long>(tid));
+                        if (e.phase == 'X') {
+                            std::fprintf(m_file, ",\"dur\":%lld}",
+                                         static_cast<long long>(e.duration));
+                        } else {
+                            std::fputs(",\"s\":\"t\"}", m_file);
+                        }
+                    }
+                    std::fflush(m_file);
+                }
+
+              private:
+                TraceSink()
+                    : m_epoch(std::chrono::steady_clock::now()),
+                      m_pid(static_cast<long>(::getpid())) {
+                    std::atexit(&TraceSink::finishAtExit);
+                }
+
+                static void finishAtExit() { instance().m_finish(); }
+
+                void m_finish() {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_file) {
+                        std::fputs("\n]\n", m_file);
+                        std::fclose(m_file);
+                        m_file = nullptr;
+                    }
+                    m_finished = true;
+                }
+
+                bool m_ensureOpen() {
+                    if (m_file) {
+                        return true;
+                    }
+                    if (m_failed) {
+                        return false;
+                    }
+                    std::string filename;
+                    auto env = std::getenv("OSVR_TRACE_FILE");
+                    if (env && env[0] != '\0') {
+                        filename = env;
+                    } else {
+                        std::ostringstream os;
+                        os << "osvr-trace-" << m_pid << ".json";
+                        filename = os.str();
+                    }
+                    m_file = std::fopen(filename.c_str(), "w");
+                    if (!m_file) {
+                        m_failed = true;
+                        return false;
+                    }
+                    std::fputs("[", m_file);
+                    return true;
+                }
+
+                void m_writeEscaped(const char *text) {
+                    for (; *text; ++text) {
+                        auto c = static_cast<unsigned char>(*text);
+                        if (c == '"' || c == '\\') {
+                            std::fputc('\\', m_file);
+                            std::fputc(c, m_file);
+                        } else if (c < 0x20) {
+                            std::fprintf(m_file, "\\u%04x", c);
+                        } else {
+                            std::fputc(c, m_file);
+                        }
+                    }
+                }
+
+                const std::chrono::steady_clock::time_point m_epoch;
+                const long m_pid;
+                std::atomic<std::uint32_t> m_threads{0};
+                std::mutex m_mutex;
+                std::FILE *m_file = nullptr;
+                bool m_first = true;
+                bool m_failed = false;
+                bool m_finished = false;
+            };
+
+            /// @brief Per-thread event buffer: recording an event touches
+            /// only this thread's storage, with no locks or atomics.
+            class ThreadBuffer {
+              public:
+                ThreadBuffer()
+                    : m_sink(TraceSink::instance()),
+                      m_tid(m_sink.registerThread()) {
+                    m_events.reserve(EVENTS_PER_FLUSH);
+                }
+                ~ThreadBuffer() { flush(); }
+                ThreadBuffer(ThreadBuffer const &) = delete;
+                ThreadBuffer &operator=(ThreadBuffer const &) = delete;
+
+                std::int64_t now() const { return m_sink.now(); }
+
+                void record(char phase, bool worker, const char *text,
+                            std::int64_t start, std::int64_t duration) {
+                    TraceEvent e;
+                    e.start = start;
+                    e.duration = duration;
+                    e.phase = phase;
+                    e.worker = worker;
+                    std::strncpy(e.name, text, sizeof(e.name) - 1);
+                    e.name[sizeof(e.name) - 1] = '\0';
+                    m_events.push_back(e);
+                    if (m_events.size() >= EVENTS_PER_FLUSH) {
+                        flush();
+                    }
+                }
+
+                void flush() {
+                    if (!m_events.empty()) {
+                        m_sink.write(m_tid, m_events);
+                        m_events.clear();
+                    }
+                }
+
+              private:
+                TraceSink &m_sink;
+                const std::uint32_t m_tid;
+                std::vector<TraceEvent> m_events;
+            };
+
+            inline ThreadBuffer &getThreadBuffer() {
+                static thread_local ThreadBuffer buffer;
+                return buffer;
+            }
+
+            inline TraceBeginStamp beginRegion() {
+                return getThreadBuffer().now();
+            }
+            inline void endRegion(bool worker, const char *text,
+                                  TraceBeginStamp stamp) {
+                auto &buf = getThreadBuffer();
+                buf.record('X', worker, text, stamp, buf.now() - stamp);
+            }
+            inline void markInstant(bool worker, const char *text) {
+                auto &buf = getThreadBuffer();
+                buf.record('i', worker, text, buf.now(), 0);
+            }
+        } // namespace
+
+        TraceBeginStamp MainTracePolicy::begin(const char *) {
+            return beginRegion();
+        }
+        void MainTracePolicy::end(const char *text, TraceBeginStamp stamp) {
+            endRegion(false, text, stamp);
+        }
+
+        void MainTracePolicy::mark(const char *text) {
+            markInstant(false, text);
+        }
+
+        TraceBeginStamp WorkerTracePolicy::begin(const char *) {
+            return beginRegion();
+        }
+        void WorkerTracePolicy::end(const char *text, TraceBeginStamp stamp) {
+            endRegion(true, text, stamp);
+        }
+
+        void WorkerTracePolicy::mark(const char *text) {
+            markInstant(true, text);
+        }
 #endif
     } // namespace tracing
 } // namespace common
@@ -0,0 +1,64 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "ActivitySignal.h"
+
+// Library/third-party includes
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace connection {
+
+    ActivitySignal::ActivitySignal() : m_pending(false) {}
+
+    void ActivitySignal::signal() {
+        {
+            LockType lock(m_mut);
+            m_pending = true;
+        }
+        m_cond.notify_one();
+    }
+
+    bool ActivitySignal::wait(int microseconds) {
+        LockType lock(m_mut);
+        if (!m_pending && microseconds > 0) {
+            auto deadline = boost::get_system_time() +
+                            boost::posix_time::microseconds(microseconds);
+            while (!m_pending) {
+                if (!m_cond.timed_wait(lock, deadline)) {
+                    break;
+                }
+            }
+        }
+        auto ret = m_pending;
+        m_pending = false;
+        return ret;
+    }
+
+} // namespace connection
+} // namespace osvr
@@ -0,0 +1,75 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ActivitySignal_h_GUID_44543BF7_FE3B_4E36_8799_A2B39F96A010
+#define INCLUDED_ActivitySignal_h_GUID_44543BF7_FE3B_4E36_8799_A2B39F96A010
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace connection {
+    /// @brief Internal class allowing any thread to wake up the thread running
+    /// the connection's main loop, so it only needs to sleep when nothing is
+    /// pending.
+    ///
+    /// Signals are "sticky": a signal raised while the main thread is not
+    /// waiting will cause the next wait to return immediately.
+    class ActivitySignal : boost::noncopyable {
+      public:
+        /// @brief Constructor
+        ActivitySignal();
+
+        /// @brief Mark that there is work pending and wake the waiting thread,
+        /// if any. Safe to call from any thread.
+        void signal();
+
+        /// @brief Block until signalled or until the timeout elapses,
+        /// consuming any pending signal.
+        ///
+        /// @param microseconds Maximum time to wait. 0 will just check and
+        /// clear the pending state without blocking.
+        ///
+        /// @returns true if woken by a signal, false if timed out.
+        bool wait(int microseconds);
+
+      private:
+        typedef boost::unique_lock<boost::mutex> LockType;
+        boost::mutex m_mut;
+        boost::condition_variable m_cond;
+        /// @brief Protected by m_mut
+        bool m_pending;
+    };
+} // namespace connection
+} // namespace osvr
+
+#endif // INCLUDED_ActivitySignal_h_GUID_44543BF7_FE3B_4E36_8799_A2B39F96A010
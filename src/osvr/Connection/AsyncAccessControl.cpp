@@ -84,6 +84,9 @@ namespace connection {
             {
                 m_lockDone.lock();
                 m_sharedDone = false;
+                if (m_control.m_requestNotifier) {
+                    m_control.m_requestNotifier();
+                }
                 while (m_mainMessage == AsyncAccessControl::MTM_WAIT) {
                     m_condAsyncThread.wait(
                         m_lock); // In here we unlock the mutex
@@ -109,6 +112,11 @@ namespace connection {
     AsyncAccessControl::AsyncAccessControl()
         : m_rts(false), m_done(false), m_mainMessage(MTM_WAIT) {}
 
+    void
+    AsyncAccessControl::setRequestNotifier(std::function<void()> const &f) {
+        m_requestNotifier = f;
+    }
+
     bool AsyncAccessControl::mainThreadCTS() {
         MainLockType lock(m_mut);
         return m_handleRTS(lock, MTM_CLEAR_TO_SEND);
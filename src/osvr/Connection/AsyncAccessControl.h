@@ -34,7 +34,7 @@
 #include <boost/optional/optional.hpp>
 
 // Standard includes
-// - none
+#include <functional>
 
 namespace osvr {
 namespace connection {
@@ -67,6 +67,13 @@ namespace connection {
         /// @returns true if there was a request to send.
         bool mainThreadDenyPermanently();
 
+        /// @brief Set a function to be called (from the async thread) each
+        /// time a new request to send is posted, so the main thread can be
+        /// woken to service it.
+        ///
+        /// Set this before the async thread starts.
+        void setRequestNotifier(std::function<void()> const &f);
+
       private:
         /// @brief Messages/status that may be set by the main thread for read
         /// by
@@ -104,6 +111,9 @@ namespace connection {
 
         boost::optional<boost::thread::id> m_currentRequestThread;
 
+        /// @brief Called when a new request is posted.
+        std::function<void()> m_requestNotifier;
+
         /// @brief For the main thread sleep/wake awaiting completion of the
         /// async thread's work.
         boost::condition_variable m_condMainThread;
@@ -27,21 +27,73 @@
 // Internal Includes
 #include "AsyncDeviceToken.h"
 #include <osvr/Connection/ConnectionDevice.h>
+#include <osvr/Connection/Connection.h>
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <cstring>
+#include <iostream>
 
 namespace osvr {
 namespace connection {
     using boost::unique_lock;
     using boost::mutex;
 
-    AsyncDeviceToken::AsyncDeviceToken(std::string const &name)
-        : OSVR_DeviceTokenObject(name) {}
+    namespace {
+        /// @brief Minimum time in seconds between warnings about messages
+        /// dropped from a full send queue.
+        const double OVERFLOW_WARNING_INTERVAL = 5.;
+
+        /// @brief Precedes each message within a batch buffer. A batch is
+        /// queued as a single entry with a null message type.
+        struct BatchRecordHeader {
+            util::time::TimeValue timestamp;
+            MessageType *type;
+            std::size_t len;
+        };
+
+        inline void appendBatchRecord(std::vector<char> &batch,
+                                      util::time::TimeValue const &timestamp,
+                                      MessageType *type,
+                                      const char *bytestream, size_t len) {
+            BatchRecordHeader header = {timestamp, type, len};
+            auto offset = batch.size();
+            batch.resize(offset + sizeof(header) + len);
+            std::memcpy(&batch[offset], &header, sizeof(header));
+            if (len > 0) {
+                std::memcpy(&batch[offset + sizeof(header)], bytestream, len);
+            }
+        }
+
+        /// @brief Calls f with the signature of ConnectionDevice::sendData
+        /// for each message in a batch buffer.
+        template <typename F>
+        inline void forEachBatchRecord(const char *batch, size_t len, F &&f) {
+            size_t offset = 0;
+            while (offset + sizeof(BatchRecordHeader) <= len) {
+                BatchRecordHeader header;
+                std::memcpy(&header, batch + offset, sizeof(header));
+                offset += sizeof(header);
+                f(header.timestamp, header.type, batch + offset, header.len);
+                offset += header.len;
+            }
+        }
+    } // namespace
+
+    AsyncDeviceToken::AsyncDeviceToken(std::string const &name,
+                                       std::size_t queueCapacity,
+                                       std::uint32_t batchMaxLatency)
+        : OSVR_DeviceTokenObject(name), m_batchMaxLatency(batchMaxLatency) {
+        if (queueCapacity > 0) {
+            m_queue.reset(new MessageQueue(queueCapacity));
+        } else {
+            // Batches only ever go through the queue.
+            m_batchMaxLatency = 0;
+        }
+    }
 
     AsyncDeviceToken::~AsyncDeviceToken() {
         OSVR_DEV_VERBOSE("AsyncDeviceToken\t"
@@ -96,8 +148,24 @@ namespace connection {
     }
     void AsyncDeviceToken::m_ensureThreadStarted() {
         if ((!m_callbackThread) && m_cb) {
+            // Wake the server mainloop as soon as we post a request, rather
+            // than waiting for it to come around on its own.
+            auto conn = m_getConnection();
+            m_notify = [conn] { conn->signalActivity(); };
+            m_accessControl.setRequestNotifier(m_notify);
+            auto cb = m_cb;
+            if (m_batchMaxLatency > 0) {
+                // Flush whatever the update produced as soon as it returns.
+                cb = [this]() -> OSVR_ReturnCode {
+                    m_inUpdate = true;
+                    auto ret = m_cb();
+                    m_inUpdate = false;
+                    m_flushBatch();
+                    return ret;
+                };
+            }
             m_callbackThread.reset(
-                new boost::thread(WaitCallbackLoop(m_run, m_cb)));
+                new boost::thread(WaitCallbackLoop(m_run, cb)));
             m_run.signalAndWaitForStart();
         }
     }
@@ -105,6 +173,21 @@ namespace connection {
     void AsyncDeviceToken::m_sendData(util::time::TimeValue const &timestamp,
                                       MessageType *type, const char *bytestream,
                                       size_t len) {
+        if (m_batchMaxLatency > 0) {
+            m_addToBatch(timestamp, type, bytestream, len);
+            return;
+        }
+        if (m_queue) {
+            // Queued mode: hand off and keep going, no waiting on the server.
+            if (!m_queue->push(timestamp, type, bytestream, len)) {
+                OSVR_DEV_VERBOSE("AsyncDeviceToken::m_sendData\t"
+                                 "send queue full, dropped a message.");
+            }
+            if (m_notify) {
+                m_notify();
+            }
+            return;
+        }
         OSVR_DEV_VERBOSE("AsyncDeviceToken::m_sendData\t"
                          "about to create RTS object");
         RequestToSend rts(m_accessControl);
@@ -123,6 +206,34 @@ namespace connection {
                          "done!");
     }
 
+    void AsyncDeviceToken::m_addToBatch(util::time::TimeValue const &timestamp,
+                                        MessageType *type,
+                                        const char *bytestream, size_t len) {
+        if (m_batch.empty()) {
+            util::time::getNow(m_batchStart);
+        }
+        appendBatchRecord(m_batch, timestamp, type, bytestream, len);
+        if (!m_inUpdate ||
+            util::time::duration(util::time::getNow(), m_batchStart) * 1e6 >=
+                m_batchMaxLatency) {
+            m_flushBatch();
+        }
+    }
+
+    void AsyncDeviceToken::m_flushBatch() {
+        if (m_batch.empty()) {
+            return;
+        }
+        if (!m_queue->pushBuffer(m_batchStart, nullptr, m_batch)) {
+            OSVR_DEV_VERBOSE("AsyncDeviceToken::m_flushBatch\t"
+                             "send queue full, dropped a batch.");
+            m_batch.clear();
+        }
+        if (m_notify) {
+            m_notify();
+        }
+    }
+
     class AsyncSendGuard : public util::GuardInterface {
       public:
         AsyncSendGuard(AsyncAccessControl &control) : m_rts(control) {}
@@ -134,12 +245,57 @@ namespace connection {
     };
 
     util::GuardPtr AsyncDeviceToken::m_getSendGuard() {
+        // Even in queued mode, interfaces that write to the connection
+        // directly rather than through sendData() need clear-to-send.
         util::GuardPtr ret(new AsyncSendGuard(m_accessControl));
         return ret;
     }
 
+    bool AsyncDeviceToken::m_isSendQueued() const {
+        return static_cast<bool>(m_queue);
+    }
+
+    void AsyncDeviceToken::m_drainQueue() {
+        auto dev = m_getConnectionDevice();
+        // Only take what was there when we started, so a fast device thread
+        // can't keep us here indefinitely.
+        auto send = [&](util::time::TimeValue const &timestamp,
+                        MessageType *type, const char *bytestream,
+                        size_t len) {
+            dev->sendData(timestamp, type, bytestream, len);
+        };
+        m_queue->drain([&](util::time::TimeValue const &timestamp,
+                           MessageType *type, const char *bytestream,
+                           size_t len) {
+            if (type) {
+                send(timestamp, type, bytestream, len);
+            } else {
+                forEachBatchRecord(bytestream, len, send);
+            }
+        });
+
+        auto overflows = m_queue->getOverflowCount();
+        if (overflows != m_reportedOverflows) {
+            // A device that overruns its queue will likely keep doing so:
+            // warn with the running total at most every few seconds.
+            auto now = util::time::getNow();
+            if (util::time::duration(now, m_lastOverflowWarning) >=
+                OVERFLOW_WARNING_INTERVAL) {
+                std::cerr << "[OSVR] Warning: device " << getName()
+                          << " has dropped " << overflows - m_reportedOverflows
+                          << " messages because its send queue was full."
+                          << std::endl;
+                m_reportedOverflows = overflows;
+                m_lastOverflowWarning = now;
+            }
+        }
+    }
+
     void AsyncDeviceToken::m_connectionInteract() {
         m_ensureThreadStarted();
+        if (m_queue) {
+            m_drainQueue();
+        }
         OSVR_DEV_VERBOSE("AsyncDeviceToken::m_connectionInteract\t"
                          "Going to send a CTS if waiting");
         bool handled = m_accessControl.mainThreadCTS();
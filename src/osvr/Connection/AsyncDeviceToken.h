@@ -29,6 +29,7 @@
 #include <osvr/Connection/DeviceToken.h>
 #include <osvr/Util/CallbackWrapper.h>
 #include "AsyncAccessControl.h"
+#include "MessageQueue.h"
 
 // Library/third-party includes
 #include <boost/thread.hpp>
@@ -36,12 +37,28 @@
 
 // Standard includes
 #include <string>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
 
 namespace osvr {
 namespace connection {
     class AsyncDeviceToken : public OSVR_DeviceTokenObject {
       public:
-        AsyncDeviceToken(std::string const &name);
+        /// @brief Constructor
+        /// @param name Device name
+        /// @param queueCapacity If non-zero, data sent through sendData() is
+        /// handed to the server thread through a lock-free queue of this
+        /// capacity, rather than by waiting for clear-to-send.
+        /// @param batchMaxLatency If non-zero, data sent during an update is
+        /// coalesced into a single queue entry, flushed when the update
+        /// returns or when the batch is this many microseconds old. Requires
+        /// a queue: DeviceInitObject::getSendQueueCapacity() supplies a
+        /// default capacity when only batching was requested.
+        AsyncDeviceToken(std::string const &name,
+                         std::size_t queueCapacity = 0,
+                         std::uint32_t batchMaxLatency = 0);
         virtual ~AsyncDeviceToken();
 
         void signalShutdown();
@@ -58,6 +75,7 @@ namespace connection {
                         MessageType *type, const char *bytestream,
                         size_t len) override;
         util::GuardPtr m_getSendGuard() override;
+        bool m_isSendQueued() const override;
 
         /// Called from the main thread - services requests to send from
         /// the async thread.
@@ -66,11 +84,45 @@ namespace connection {
         void m_stopThreads() override;
 
         void m_ensureThreadStarted();
+
+        /// @brief Called from the async thread - appends a message to the
+        /// current batch, flushing it if it has gotten too old.
+        void m_addToBatch(util::time::TimeValue const &timestamp,
+                          MessageType *type, const char *bytestream,
+                          size_t len);
+
+        /// @brief Called from the async thread - hands the current batch, if
+        /// any, to the queue.
+        void m_flushBatch();
+
+        /// @brief Called from the main thread - sends everything waiting in
+        /// the queue.
+        void m_drainQueue();
         DeviceUpdateCallback m_cb;
         unique_ptr<boost::thread> m_callbackThread;
 
         AsyncAccessControl m_accessControl;
 
+        /// @brief Send queue, if in queued mode.
+        unique_ptr<MessageQueue> m_queue;
+        /// @brief Maximum batch age in microseconds, or 0 if not batching.
+        std::uint32_t m_batchMaxLatency;
+        /// @brief Messages coalesced so far in this update, touched only by
+        /// the async thread.
+        std::vector<char> m_batch;
+        /// @brief When the first message of the current batch was added.
+        util::time::TimeValue m_batchStart;
+        /// @brief Whether the async thread is inside the update callback:
+        /// messages sent outside it are flushed right away.
+        bool m_inUpdate = false;
+
+        /// @brief Wakes up the server thread.
+        std::function<void()> m_notify;
+        /// @brief Overflow count as of our last warning, and when that was,
+        /// touched only by the main thread.
+        std::uint64_t m_reportedOverflows = 0;
+        util::time::TimeValue m_lastOverflowWarning = {0, 0};
+
         ::util::RunLoopManagerBoost m_run;
     };
 } // namespace connection
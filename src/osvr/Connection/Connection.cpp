@@ -28,8 +28,10 @@
 #include <osvr/Util/SharedPtr.h>
 #include <osvr/PluginHost/RegistrationContext.h>
 #include <osvr/Connection/MessageType.h>
+#include <osvr/Common/InProcessReports.h>
 #include "VrpnBasedConnection.h"
 #include "GenericConnectionDevice.h"
+#include "ActivitySignal.h"
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
@@ -148,6 +150,12 @@ namespace connection {
         }
     }
 
+    void Connection::signalActivity() { m_activity->signal(); }
+
+    bool Connection::waitForActivity(int microseconds) {
+        return m_activity->wait(microseconds);
+    }
+
     void Connection::registerConnectionHandler(std::function<void()> handler) {
         m_registerConnectionHandler(handler);
     }
@@ -161,7 +169,13 @@ namespace connection {
         }
     }
 
-    Connection::Connection() {}
+    common::InProcessReportsPtr Connection::getInProcessReports() const {
+        return m_inProcessReports;
+    }
+
+    Connection::Connection()
+        : m_activity(new ActivitySignal),
+          m_inProcessReports(make_shared<common::InProcessReports>()) {}
 
     Connection::~Connection() {}
 
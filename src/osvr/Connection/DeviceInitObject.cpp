@@ -35,6 +35,10 @@
 using osvr::pluginhost::PluginSpecificRegistrationContext;
 using osvr::connection::Connection;
 
+/// @brief Number of batches queued at once if batching was requested without
+/// a queue capacity.
+static const std::size_t DEFAULT_BATCH_QUEUE_CAPACITY = 16;
+
 OSVR_DeviceInitObject::OSVR_DeviceInitObject(OSVR_PluginRegContext ctx)
     : m_context(&PluginSpecificRegistrationContext::get(ctx)),
       m_conn(Connection::retrieveConnection(m_context->getParent())),
@@ -102,6 +106,21 @@ void OSVR_DeviceInitObject::setTracker(
     m_trackerIface = iface;
 }
 
+void OSVR_DeviceInitObject::setSendQueueCapacity(std::size_t capacity) {
+    m_sendQueueCapacity = capacity;
+}
+
+void OSVR_DeviceInitObject::setSendBatchMaxLatency(uint32_t microseconds) {
+    m_sendBatchMaxLatency = microseconds;
+}
+
+std::size_t OSVR_DeviceInitObject::getSendQueueCapacity() const {
+    if (0 == m_sendQueueCapacity && m_sendBatchMaxLatency > 0) {
+        return DEFAULT_BATCH_QUEUE_CAPACITY;
+    }
+    return m_sendQueueCapacity;
+}
+
 void OSVR_DeviceInitObject::addServerInterface(
     osvr::connection::ServerInterfacePtr const &iface) {
     m_serverInterfaces.push_back(iface);
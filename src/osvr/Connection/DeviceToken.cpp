@@ -30,6 +30,7 @@
 #include <osvr/Connection/DeviceInitObject.h>
 #include <osvr/Connection/Connection.h>
 #include <osvr/Connection/ConnectionDevice.h>
+#include <osvr/Common/Tracing.h>
 
 // Library/third-party includes
 // - none
@@ -49,7 +50,9 @@ using osvr::util::GuardPtr;
 
 DeviceTokenPtr
 OSVR_DeviceTokenObject::createAsyncDevice(DeviceInitObject &init) {
-    DeviceTokenPtr ret(new AsyncDeviceToken(init.getQualifiedName()));
+    DeviceTokenPtr ret(new AsyncDeviceToken(init.getQualifiedName(),
+                                            init.getSendQueueCapacity(),
+                                            init.getSendBatchMaxLatency()));
     ret->m_sharedInit(init);
     return ret;
 }
@@ -80,6 +83,7 @@ std::string const &OSVR_DeviceTokenObject::getName() const { return m_name; }
 
 void OSVR_DeviceTokenObject::sendData(MessageType *type, const char *bytestream,
                                       size_t len) {
+    osvr::common::tracing::DeviceSend trace;
     osvr::util::time::TimeValue tv;
     osvr::util::time::getNow(tv);
     m_sendData(tv, type, bytestream, len);
@@ -87,11 +91,14 @@ void OSVR_DeviceTokenObject::sendData(MessageType *type, const char *bytestream,
 void OSVR_DeviceTokenObject::sendData(
     osvr::util::time::TimeValue const &timestamp, MessageType *type,
     const char *bytestream, size_t len) {
+    osvr::common::tracing::DeviceSend trace;
     m_sendData(timestamp, type, bytestream, len);
 }
 
 GuardPtr OSVR_DeviceTokenObject::getSendGuard() { return m_getSendGuard(); }
 
+bool OSVR_DeviceTokenObject::isSendQueued() const { return m_isSendQueued(); }
+
 void OSVR_DeviceTokenObject::setUpdateCallback(
     osvr::connection::DeviceUpdateCallback const &cb) {
     m_setUpdateCallback(cb);
@@ -128,6 +135,8 @@ ConnectionDevicePtr OSVR_DeviceTokenObject::m_getConnectionDevice() {
 
 void OSVR_DeviceTokenObject::m_stopThreads() {}
 
+bool OSVR_DeviceTokenObject::m_isSendQueued() const { return false; }
+
 void OSVR_DeviceTokenObject::m_sharedInit(DeviceInitObject &init) {
     m_conn = init.getConnection();
     m_dev = m_conn->createConnectionDevice(init);
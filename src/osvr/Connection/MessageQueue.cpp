@@ -0,0 +1,78 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "MessageQueue.h"
+
+// Library/third-party includes
+#include <boost/assert.hpp>
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace connection {
+
+    MessageQueue::MessageQueue(std::size_t capacity)
+        : m_entries(capacity + 1), m_head(0), m_tail(0), m_overflows(0) {
+        BOOST_ASSERT_MSG(capacity > 0, "Queue capacity must be non-zero!");
+    }
+
+    bool MessageQueue::push(util::time::TimeValue const &timestamp,
+                            MessageType *type, const char *bytestream,
+                            std::size_t len) {
+        auto const tail = m_tail.load(std::memory_order_relaxed);
+        auto const next = m_next(tail);
+        if (next == m_head.load(std::memory_order_acquire)) {
+            // Full - drop this one rather than stall the device thread.
+            ++m_overflows;
+            return false;
+        }
+        auto &entry = m_entries[tail];
+        entry.timestamp = timestamp;
+        entry.type = type;
+        entry.data.assign(bytestream, bytestream + len);
+        m_tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    bool MessageQueue::pushBuffer(util::time::TimeValue const &timestamp,
+                                  MessageType *type, std::vector<char> &data) {
+        auto const tail = m_tail.load(std::memory_order_relaxed);
+        auto const next = m_next(tail);
+        if (next == m_head.load(std::memory_order_acquire)) {
+            ++m_overflows;
+            return false;
+        }
+        auto &entry = m_entries[tail];
+        entry.timestamp = timestamp;
+        entry.type = type;
+        entry.data.swap(data);
+        data.clear();
+        m_tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+} // namespace connection
+} // namespace osvr
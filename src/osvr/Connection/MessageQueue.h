@@ -0,0 +1,132 @@
+/** @file
+    @brief Header
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MessageQueue_h_GUID_768E3986_E997_4DE9_BAFF_690324AC809B
+#define INCLUDED_MessageQueue_h_GUID_768E3986_E997_4DE9_BAFF_690324AC809B
+
+// Internal Includes
+#include <osvr/Connection/MessageTypePtr.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace osvr {
+namespace connection {
+    /// @brief A bounded, lock-free, single-producer/single-consumer queue of
+    /// serialized, timestamped messages, used to hand data from an async
+    /// device thread to the server thread without blocking either one.
+    ///
+    /// Each slot keeps its buffer between uses, so once the slots have grown
+    /// to the size of the messages being sent, neither side allocates.
+    ///
+    /// If the queue is full, push() drops the new message and increments the
+    /// overflow count rather than waiting.
+    class MessageQueue : boost::noncopyable {
+      public:
+        /// @brief Constructor
+        /// @param capacity Maximum number of messages held at once.
+        explicit MessageQueue(std::size_t capacity);
+
+        /// @brief Copy a message into the queue. Only call from the single
+        /// producer thread.
+        ///
+        /// @returns false if the queue was full and the message was dropped.
+        bool push(util::time::TimeValue const &timestamp, MessageType *type,
+                  const char *bytestream, std::size_t len);
+
+        /// @brief Move a message buffer into the queue without copying it:
+        /// the buffer is swapped with the slot's, so on return @p data holds
+        /// the slot's old (cleared) buffer for reuse. Only call from the
+        /// single producer thread.
+        ///
+        /// @returns false if the queue was full and the message was dropped
+        /// (in which case @p data is left untouched).
+        bool pushBuffer(util::time::TimeValue const &timestamp,
+                        MessageType *type, std::vector<char> &data);
+
+        /// @brief Pass queued messages, oldest first, to a function with the
+        /// signature of ConnectionDevice::sendData, then release their slots.
+        /// Only call from the single consumer thread.
+        ///
+        /// @param f Function object called as `f(timestamp, type, buf, len)`
+        /// @param maxMessages Stop after this many messages, to bound the
+        /// time spent here when the producer is outpacing us. 0 means no
+        /// limit beyond what is in the queue when we start.
+        ///
+        /// @returns number of messages handled.
+        template <typename F>
+        std::size_t drain(F &&f, std::size_t maxMessages = 0);
+
+        /// @brief Number of messages dropped because the queue was full.
+        std::uint64_t getOverflowCount() const { return m_overflows.load(); }
+
+        /// @brief Maximum number of messages held at once.
+        std::size_t capacity() const { return m_entries.size() - 1; }
+
+      private:
+        struct Entry {
+            util::time::TimeValue timestamp;
+            MessageType *type;
+            std::vector<char> data;
+        };
+        std::size_t m_next(std::size_t i) const {
+            return (i + 1 == m_entries.size()) ? 0 : i + 1;
+        }
+        /// @brief One more slot than the capacity, so that "full" and "empty"
+        /// can be told apart from the indices alone.
+        std::vector<Entry> m_entries;
+        /// @brief Index of the next slot to read: written only by consumer.
+        std::atomic<std::size_t> m_head;
+        /// @brief Index of the next slot to write: written only by producer.
+        std::atomic<std::size_t> m_tail;
+        std::atomic<std::uint64_t> m_overflows;
+    };
+
+    template <typename F>
+    inline std::size_t MessageQueue::drain(F &&f, std::size_t maxMessages) {
+        auto head = m_head.load(std::memory_order_relaxed);
+        auto const tail = m_tail.load(std::memory_order_acquire);
+        std::size_t count = 0;
+        while (head != tail && (maxMessages == 0 || count < maxMessages)) {
+            auto &entry = m_entries[head];
+            f(entry.timestamp, entry.type, entry.data.data(),
+              entry.data.size());
+            head = m_next(head);
+            m_head.store(head, std::memory_order_release);
+            ++count;
+        }
+        return count;
+    }
+
+} // namespace connection
+} // namespace osvr
+
+#endif // INCLUDED_MessageQueue_h_GUID_768E3986_E997_4DE9_BAFF_690324AC809B
@@ -27,12 +27,17 @@
 
 // Internal Includes
 #include "DeviceConstructionData.h"
+#include "VrpnMessageType.h"
 #include <osvr/Connection/TrackerServerInterface.h>
+#include <osvr/Connection/DeviceToken.h>
+#include <osvr/Connection/Connection.h>
+#include <osvr/Common/InProcessReports.h>
 #include <osvr/Util/QuatlibInteropC.h>
 
 // Library/third-party includes
 #include <vrpn_Tracker.h>
 #include <quat.h>
+#include <boost/assert.hpp>
 
 // Standard includes
 // - none
@@ -52,9 +57,45 @@ namespace connection {
             m_resetVel();
             m_resetAccel();
 
+            if (init.obj.getSendQueueCapacity() > 0) {
+                // Queued async device (which includes one that only asked
+                // for batching): we'll send through the device token instead
+                // of directly on the connection, so we need message type
+                // objects for our messages.
+                vrpn_ConnectionPtr conn(init.conn);
+                m_poseType.reset(new VrpnMessageType(
+                    d_connection->message_type_name(Base::position_m_id),
+                    conn));
+                m_velType.reset(new VrpnMessageType(
+                    d_connection->message_type_name(Base::velocity_m_id),
+                    conn));
+                m_accelType.reset(new VrpnMessageType(
+                    d_connection->message_type_name(Base::accel_m_id), conn));
+                init.obj.addTokenInterest(&m_token);
+            } else {
+                // Reports are sent on this thread (or while it's held), so we
+                // can also hand them straight to analysis plugins in process.
+                // (Queued reports only reach the connection later, so those
+                // still go only through VRPN. The capacity checked above
+                // accounts for batching, so the token agrees - we keep it to
+                // assert as much.)
+                init.obj.addTokenInterest(&m_token);
+                m_inProcessReports =
+                    init.obj.getConnection()->getInProcessReports();
+                m_inProcess = &(m_inProcessReports->getTrackerChannel(
+                    init.getQualifiedName()));
+                m_inProcess->attachPublisher();
+            }
+
             // Report interface out.
             init.obj.returnTrackerInterface(*this);
         }
+        ~VrpnTrackerServer() {
+            if (m_inProcess) {
+                m_inProcess->detachPublisher();
+            }
+        }
+
         static const vrpn_uint32 CLASS_OF_SERVICE = vrpn_CONNECTION_LOW_LATENCY;
 
         virtual void sendReport(OSVR_PositionState const &val,
@@ -165,38 +206,101 @@ namespace connection {
         void m_sendPose(OSVR_ChannelCount sensor,
                         util::time::TimeValue const &ts) {
 
+            if (m_shouldPublishInProcess()) {
+                OSVR_PoseState pose;
+                osvrVec3FromQuatlib(&(pose.translation), Base::pos);
+                osvrQuatFromQuatlib(&(pose.rotation), Base::d_quat);
+                m_inProcess->publishPose(sensor, pose, ts);
+            }
+
             Base::d_sensor = sensor;
             util::time::toStructTimeval(Base::timestamp, ts);
             char msgbuf[1000];
             vrpn_int32 len = Base::encode_to(msgbuf);
-            d_connection->pack_message(len, Base::timestamp,
-                                       Base::position_m_id, Base::d_sender_id,
-                                       msgbuf, CLASS_OF_SERVICE);
+            m_pack(ts, m_poseType, Base::position_m_id, msgbuf, len);
         }
 
         void m_sendVelocity(OSVR_ChannelCount sensor,
                             util::time::TimeValue const &ts) {
 
+            if (m_shouldPublishInProcess()) {
+                OSVR_VelocityState vel;
+                osvrVec3FromQuatlib(&(vel.linearVelocity), Base::vel);
+                osvrQuatFromQuatlib(&(vel.angularVelocity.incrementalRotation),
+                                    Base::vel_quat);
+                vel.angularVelocity.dt = Base::vel_quat_dt;
+                m_inProcess->publishVelocity(sensor, vel, ts);
+            }
+
             Base::d_sensor = sensor;
             util::time::toStructTimeval(Base::timestamp, ts);
             char msgbuf[1000];
             vrpn_int32 len = Base::encode_vel_to(msgbuf);
-            d_connection->pack_message(len, Base::timestamp,
-                                       Base::velocity_m_id, Base::d_sender_id,
-                                       msgbuf, CLASS_OF_SERVICE);
+            m_pack(ts, m_velType, Base::velocity_m_id, msgbuf, len);
         }
 
         void m_sendAccel(OSVR_ChannelCount sensor,
                          util::time::TimeValue const &ts) {
 
+            if (m_shouldPublishInProcess()) {
+                OSVR_AccelerationState accel;
+                osvrVec3FromQuatlib(&(accel.linearAcceleration), Base::acc);
+                osvrQuatFromQuatlib(
+                    &(accel.angularAcceleration.incrementalRotation),
+                    Base::acc_quat);
+                accel.angularAcceleration.dt = Base::acc_quat_dt;
+                m_inProcess->publishAcceleration(sensor, accel, ts);
+            }
+
             Base::d_sensor = sensor;
             util::time::toStructTimeval(Base::timestamp, ts);
             char msgbuf[1000];
             vrpn_int32 len = Base::encode_acc_to(msgbuf);
-            d_connection->pack_message(len, Base::timestamp, Base::accel_m_id,
+            m_pack(ts, m_accelType, Base::accel_m_id, msgbuf, len);
+        }
+
+        /// @brief Whether to hand a report to analysis plugins in process:
+        /// only if someone's listening, and only from a device whose token
+        /// sends directly, so that we're on (or holding) the main thread.
+        bool m_shouldPublishInProcess() const {
+            if (!m_inProcess) {
+                return false;
+            }
+            BOOST_ASSERT_MSG(!(m_token && m_token->isSendQueued()),
+                             "Queued devices must not publish in process!");
+            return m_inProcess->hasListeners();
+        }
+
+        /// @brief Sends an encoded message: through the device token's queue
+        /// if we have one, otherwise directly on the connection.
+        void m_pack(util::time::TimeValue const &ts,
+                    MessageTypePtr const &type, vrpn_int32 msgID,
+                    const char *msgbuf, vrpn_int32 len) {
+            if (m_token && type) {
+                m_token->sendData(ts, type.get(), msgbuf, len);
+                return;
+            }
+            d_connection->pack_message(len, Base::timestamp, msgID,
                                        Base::d_sender_id, msgbuf,
                                        CLASS_OF_SERVICE);
         }
+
+        /// @name Used only for devices that send directly.
+        /// @{
+        common::InProcessReportsPtr m_inProcessReports;
+        common::InProcessTrackerChannel *m_inProcess = nullptr;
+        /// @}
+
+        /// @brief The device token, once known. (Virtual devices never
+        /// report one.)
+        DeviceToken *m_token = nullptr;
+
+        /// @name Used only for queued async devices.
+        /// @{
+        MessageTypePtr m_poseType;
+        MessageTypePtr m_velType;
+        MessageTypePtr m_accelType;
+        /// @}
     };
 
 } // namespace connection
@@ -77,20 +77,27 @@ namespace client {
         m_systemDevice = common::createClientDevice(sysDeviceName, m_mainConn);
         m_systemComponent =
             m_systemDevice->addComponent(common::SystemComponent::create());
-        typedef common::DeduplicatingFunctionWrapper<Json::Value const &>
-            DedupJsonFunction;
-
+        // Without deltas, the server re-sends the whole tree whenever a
+        // client connects: skip rebuilding ours if it hasn't changed. (With
+        // deltas, full trees come through the delta handler instead.)
         using DedupJsonFunction =
             common::DeduplicatingFunctionWrapper<Json::Value const &>;
         m_systemComponent->registerReplaceTreeHandler(
-            DedupJsonFunction([&](Json::Value nodes) {
+            DedupJsonFunction([&](Json::Value const &nodes) {
 
                 OSVR_DEV_VERBOSE("Got updated path tree, processing");
 
                 // Tree observers will handle destruction/creation of remote
-                // handlers.
+                // handlers - only for those paths whose source changed.
                 m_pathTreeOwner.replaceTree(nodes);
             }));
+        m_systemComponent->registerTreeDeltaHandler(
+            [&](Json::Value const &delta, util::time::TimeValue const &) {
+                if (!m_pathTreeOwner.applyTreeDelta(delta)) {
+                    // Out of step with the server: ask for the whole tree.
+                    m_systemComponent->sendTreeRequest();
+                }
+            });
     }
 
     JointClientContext::~JointClientContext() {}
@@ -210,6 +210,22 @@ osvrDeviceAsyncInitWithOptions(OSVR_IN_PTR OSVR_PluginRegContext,
                                  OSVR_DeviceTokenObject::createAsyncDevice);
 }
 
+OSVR_ReturnCode osvrDeviceAsyncSetSendQueueCapacity(
+    OSVR_INOUT_PTR OSVR_DeviceInitOptions options, OSVR_IN size_t capacity) {
+    OSVR_PLUGIN_HANDLE_NULL_CONTEXT("osvrDeviceAsyncSetSendQueueCapacity",
+                                    options);
+    options->setSendQueueCapacity(capacity);
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode
+osvrDeviceAsyncSetSendBatching(OSVR_INOUT_PTR OSVR_DeviceInitOptions options,
+                               OSVR_IN uint32_t maxLatencyMicroseconds) {
+    OSVR_PLUGIN_HANDLE_NULL_CONTEXT("osvrDeviceAsyncSetSendBatching", options);
+    options->setSendBatchMaxLatency(maxLatencyMicroseconds);
+    return OSVR_RETURN_SUCCESS;
+}
+
 OSVR_ReturnCode osvrDeviceMicrosleep(OSVR_IN uint64_t microseconds) {
     boost::this_thread::sleep(boost::posix_time::microseconds(microseconds));
     return OSVR_RETURN_SUCCESS;
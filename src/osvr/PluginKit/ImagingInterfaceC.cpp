@@ -112,3 +112,33 @@ osvrDeviceImagingReportFrame(OSVR_IN_PTR OSVR_DeviceToken,
 
     return OSVR_RETURN_FAILURE;
 }
+
+OSVR_ReturnCode osvrDeviceImagingAcquireBuffer(
+    OSVR_IN_PTR OSVR_DeviceToken, OSVR_IN_PTR OSVR_ImagingDeviceInterface iface,
+    OSVR_IN OSVR_ImagingMetadata metadata, OSVR_IN OSVR_ChannelCount sensor,
+    OSVR_OUT_PTR OSVR_ImageBufferElement **buffer) {
+    OSVR_PLUGIN_HANDLE_NULL_CONTEXT("osvrDeviceImagingAcquireBuffer", iface);
+    OSVR_PLUGIN_HANDLE_NULL_CONTEXT("osvrDeviceImagingAcquireBuffer", buffer);
+    *buffer = iface->imaging->acquireImageBuffer(metadata, sensor);
+    if (!*buffer) {
+        return OSVR_RETURN_FAILURE;
+    }
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode
+osvrDeviceImagingCommitBuffer(OSVR_IN_PTR OSVR_DeviceToken,
+                              OSVR_IN_PTR OSVR_ImagingDeviceInterface iface,
+                              OSVR_IN OSVR_ChannelCount sensor,
+                              OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
+    OSVR_PLUGIN_HANDLE_NULL_CONTEXT("osvrDeviceImagingCommitBuffer", iface);
+    auto guard = iface->getSendGuard();
+    if (guard->lock()) {
+        if (iface->imaging->commitImageBuffer(sensor, *timestamp)) {
+            return OSVR_RETURN_SUCCESS;
+        }
+        return OSVR_RETURN_FAILURE;
+    }
+    iface->imaging->discardImageBuffer(sensor);
+    return OSVR_RETURN_FAILURE;
+}
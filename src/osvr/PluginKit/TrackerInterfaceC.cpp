@@ -64,8 +64,9 @@ osvrTrackerSend(const char method[], OSVR_DeviceToken,
                 OSVR_ChannelCount sensor, OSVR_TimeValue const *timestamp) {
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, iface);
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, timestamp);
-    return useSendGuardVoid(
-        iface, [&]() { iface->tracker->sendReport(*val, sensor, *timestamp); });
+    return useSendGuardUnlessQueuedVoid(iface, [&]() {
+        iface->tracker->sendReport(*val, sensor, *timestamp);
+    });
 }
 
 template <typename StateType>
@@ -75,7 +76,7 @@ osvrTrackerSendVel(const char method[], OSVR_DeviceToken,
                    OSVR_ChannelCount sensor, OSVR_TimeValue const *timestamp) {
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, iface);
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, timestamp);
-    return useSendGuardVoid(iface, [&]() {
+    return useSendGuardUnlessQueuedVoid(iface, [&]() {
         iface->tracker->sendVelReport(*val, sensor, *timestamp);
     });
 }
@@ -89,7 +90,7 @@ osvrTrackerSendAccel(const char method[], OSVR_DeviceToken,
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, iface);
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, timestamp);
 
-    return useSendGuardVoid(iface, [&]() {
+    return useSendGuardUnlessQueuedVoid(iface, [&]() {
         iface->tracker->sendAccelReport(*val, sensor, *timestamp);
     });
 }
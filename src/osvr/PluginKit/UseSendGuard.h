@@ -33,6 +33,7 @@
 
 // Standard includes
 #include <exception>
+#include <utility>
 
 /// Calls a function using the send guard, returning the return value of the
 /// function if it completes without exception.
@@ -62,4 +63,25 @@ inline OSVR_ReturnCode useSendGuardVoid(InterfaceType &iface, F &&func) {
         return OSVR_RETURN_SUCCESS;
     });
 }
+
+/// Calls a void function, using the send guard only if the device doesn't
+/// queue its sends (in which case the function must only send through the
+/// device token), returning success if it completes without exception.
+template <typename InterfaceType, typename F>
+inline OSVR_ReturnCode useSendGuardUnlessQueuedVoid(InterfaceType &iface,
+                                                    F &&func) {
+    if (!iface->isSendQueued()) {
+        return useSendGuardVoid(iface, std::forward<F>(func));
+    }
+    try {
+        func();
+    } catch (std::exception const &e) {
+        OSVR_DEV_VERBOSE("Caught exception: " << e.what());
+        return OSVR_RETURN_FAILURE;
+    } catch (...) {
+        OSVR_DEV_VERBOSE("Caught non-standard exception!");
+        return OSVR_RETURN_FAILURE;
+    }
+    return OSVR_RETURN_SUCCESS;
+}
 #endif // INCLUDED_UseSendGuard_h_GUID_FEAB5647_E86B_4BA2_0A29_CB5665678CCB
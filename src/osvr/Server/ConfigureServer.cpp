@@ -99,6 +99,8 @@ namespace server {
     static const char LOCAL_KEY[] = "local";
     static const char PORT_KEY[] = "port"; // not the triwizard cup.
     static const char SLEEP_KEY[] = "sleep";
+    static const char EVENT_DRIVEN_KEY[] = "eventDriven";
+    static const char PATH_TREE_DELTAS_KEY[] = "pathTreeDeltas";
 
     ServerPtr ConfigureServer::constructServer() {
         Json::Value const &root(m_data->root);
@@ -110,6 +112,8 @@ namespace server {
 #else
         int sleepTime = 1000; // microseconds
 #endif
+        bool eventDriven = false;
+        bool pathTreeDeltas = false;
 
         /// Extract data from the JSON structure.
         if (root.isMember(SERVER_KEY)) {
@@ -141,6 +145,16 @@ namespace server {
                 // Convert to microseconds for internal use.
                 sleepTime = static_cast<int>(jsonSleepTime.asDouble() * 1000.0);
             }
+
+            Json::Value jsonEventDriven = jsonServer[EVENT_DRIVEN_KEY];
+            if (jsonEventDriven.isBool()) {
+                eventDriven = jsonEventDriven.asBool();
+            }
+
+            Json::Value jsonPathTreeDeltas = jsonServer[PATH_TREE_DELTAS_KEY];
+            if (jsonPathTreeDeltas.isBool()) {
+                pathTreeDeltas = jsonPathTreeDeltas.asBool();
+            }
         }
 
         /// Construct a server, or a connection then a server, based on the
@@ -156,6 +170,8 @@ namespace server {
         if (sleepTime > 0.0) {
             m_server->setSleepTime(sleepTime);
         }
+        m_server->setEventDriven(eventDriven);
+        m_server->setPathTreeDeltas(pathTreeDeltas);
 
         m_server->setHardwareDetectOnConnection();
 
@@ -113,6 +113,14 @@ namespace server {
 #if 0
     int Server::getSleepTime() const { return m_impl->getSleepTime(); }
 #endif
+    void Server::setEventDriven(bool eventDriven) {
+        m_impl->setEventDriven(eventDriven);
+    }
+
+    void Server::setPathTreeDeltas(bool deltas) {
+        m_impl->setPathTreeDeltas(deltas);
+    }
+
     Server::Server(connection::ConnectionPtr const &conn,
                    private_constructor const &)
         : m_impl(new ServerImpl(conn)) {}
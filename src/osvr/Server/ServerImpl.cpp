@@ -40,6 +40,7 @@
 #include <osvr/Common/AliasProcessor.h>
 #include <osvr/Util/StringLiteralFileToString.h>
 #include <osvr/Common/Tracing.h>
+#include <osvr/Common/PathTreeSerialization.h>
 
 #include "osvr/Server/display_json.h" /// Fallback display descriptor.
 
@@ -87,13 +88,15 @@ namespace server {
             m_systemDevice->addComponent(common::SystemComponent::create());
         m_systemComponent->registerClientRouteUpdateHandler(
             &ServerImpl::m_handleUpdatedRoute, this);
+        m_systemComponent->registerTreeRequestHandler(
+            [&] { m_queueTreeSend(); });
 
         // Things to do when we get a new incoming connection
         // No longer doing hardware detect unconditionally here - see
         // triggerHardwareDetect()
         m_commonComponent =
             m_systemDevice->addComponent(common::CommonComponent::create());
-        m_commonComponent->registerPingHandler([&] { m_queueTreeSend(); });
+        m_commonComponent->registerPingHandler([&] { m_handlePing(); });
 
         // Set up the default display descriptor.
         m_tree.getNodeByPath("/display").value() =
@@ -164,6 +167,7 @@ namespace server {
     void ServerImpl::signalStop() {
         boost::unique_lock<boost::mutex> lock(m_runControl);
         m_run.signalShutdown();
+        m_signalActivity();
     }
 
     void ServerImpl::loadPlugin(std::string const &pluginName) {
@@ -216,7 +220,7 @@ namespace server {
             m_ctx->triggerHardwareDetect();
             m_triggeredDetect = false;
         }
-        if (m_treeDirty) {
+        if (m_treeDirty || m_treeSendNeeded) {
             OSVR_DEV_VERBOSE("Path tree updated or connection detected");
             m_sendTree();
             m_treeDirty.reset();
@@ -233,12 +237,22 @@ namespace server {
             shouldContinue = m_run.shouldContinue();
         }
 
-        if (m_currentSleepTime > 0) {
+        if (m_eventDriven) {
+            // Sleep at most as long as we otherwise would, but wake as soon
+            // as there is something for us to do.
+            m_conn->waitForActivity(m_currentSleepTime);
+        } else if (m_currentSleepTime > 0) {
             osvr::util::time::microsleep(m_currentSleepTime);
         }
         return shouldContinue;
     }
 
+    void ServerImpl::m_signalActivity() const {
+        if (m_conn) {
+            m_conn->signalActivity();
+        }
+    }
+
     bool ServerImpl::addRoute(std::string const &routingDirective) {
         bool wasNew;
         m_callControlled([&] { wasNew = m_addRoute(routingDirective); });
@@ -348,13 +362,76 @@ namespace server {
         m_treeDirty += change;
         return change;
     }
+    void ServerImpl::m_handlePing() {
+        // A new client needs the tree (or, with deltas, just the version:
+        // clients that don't have it will ask for the whole tree).
+        m_callControlled([&] { m_treeSendNeeded = true; });
+    }
     void ServerImpl::m_queueTreeSend() {
-        m_callControlled([&] { m_treeDirty += true; });
+        m_callControlled([&] {
+            m_treeSendNeeded = true;
+            m_treeFullSendNeeded = true;
+        });
     }
     void ServerImpl::m_sendTree() {
-        OSVR_DEV_VERBOSE("Sending path tree to clients.");
-        common::tracing::markPathTreeBroadcast();
-        m_systemComponent->sendReplacementTree(m_tree);
+        // Pings alone don't change the tree: only re-serialize it if
+        // something has.
+        bool changed = m_treeDirty || m_lastSentTree.isNull();
+        Json::Value nodes;
+        if (changed) {
+            nodes = common::pathTreeToJson(m_tree);
+        }
+        if (!m_pathTreeDeltas) {
+            if (changed) {
+                m_lastSentTree = std::move(nodes);
+            }
+            OSVR_DEV_VERBOSE("Sending path tree to clients.");
+            common::tracing::markPathTreeBroadcast();
+            m_systemComponent->sendReplacementTree(m_lastSentTree);
+            m_treeFullSendNeeded = false;
+            m_treeSendNeeded = false;
+            return;
+        }
+
+        if (m_treeFullSendNeeded) {
+            // Keep the version if nothing changed, so clients that already
+            // have this tree can ignore it.
+            if (changed && nodes != m_lastSentTree) {
+                ++m_treeVersion;
+                m_lastSentTree = std::move(nodes);
+            } else if (m_treeVersion == 0) {
+                ++m_treeVersion;
+            }
+            OSVR_DEV_VERBOSE("Sending full path tree to clients.");
+            common::tracing::markPathTreeBroadcast();
+            Json::Value full(Json::objectValue);
+            full["version"] = Json::UInt64(m_treeVersion);
+            full["nodes"] = m_lastSentTree;
+            m_systemComponent->sendTreeDelta(full);
+            m_treeFullSendNeeded = false;
+            m_treeSendNeeded = false;
+            return;
+        }
+
+        if (changed) {
+            auto delta = common::diffPathTreeJson(m_lastSentTree, nodes);
+            if (!common::isPathTreeDeltaEmpty(delta)) {
+                OSVR_DEV_VERBOSE("Sending path tree changes to clients.");
+                common::tracing::markPathTreeBroadcast();
+                delta["baseVersion"] = Json::UInt64(m_treeVersion);
+                ++m_treeVersion;
+                delta["version"] = Json::UInt64(m_treeVersion);
+                m_systemComponent->sendTreeDelta(delta);
+                m_lastSentTree = std::move(nodes);
+            }
+        }
+
+        if (m_treeSendNeeded) {
+            Json::Value stamp(Json::objectValue);
+            stamp["version"] = Json::UInt64(m_treeVersion);
+            m_systemComponent->sendTreeDelta(stamp);
+            m_treeSendNeeded = false;
+        }
     }
 
     void ServerImpl::setSleepTime(int microseconds) {
@@ -363,6 +440,16 @@ namespace server {
 #if 0
     int ServerImpl::getSleepTime() const { return m_sleepTime; }
 #endif
+
+    void ServerImpl::setEventDriven(bool eventDriven) {
+        m_eventDriven = eventDriven;
+    }
+
+    void ServerImpl::setPathTreeDeltas(bool deltas) {
+        m_pathTreeDeltas = deltas;
+        m_treeFullSendNeeded = true;
+    }
+
     void ServerImpl::m_handleDeviceDescriptors() {
         for (auto const &dev : m_conn->getDevices()) {
             auto const &descriptor = dev->getDeviceDescriptor();
@@ -46,7 +46,7 @@
 #include <json/value.h>
 
 // Standard includes
-// - none
+#include <cstdint>
 
 namespace osvr {
 namespace server {
@@ -114,6 +114,12 @@ namespace server {
 
         /// @copydoc Server::setSleepTime()
         void setSleepTime(int microseconds);
+
+        /// @copydoc Server::setEventDriven()
+        void setEventDriven(bool eventDriven);
+
+        /// @copydoc Server::setPathTreeDeltas()
+        void setPathTreeDeltas(bool deltas);
 #if 0
         /// @copydoc Server::getSleepTime()
         int getSleepTime() const;
@@ -134,6 +140,9 @@ namespace server {
         /// @brief The actual guts of the update
         void m_update();
 
+        /// @brief Wake the main loop if it is waiting for activity.
+        void m_signalActivity() const;
+
         /// @brief Internal function to call a callable if the thread isn't
         /// running, or to queue up the callable if it is running.
         template <typename Callable> void m_callControlled(Callable f);
@@ -145,10 +154,14 @@ namespace server {
         /// order.
         void m_orderedDestruction();
 
-        /// @brief Queues up a tree transmission for next time around
+        /// @brief Handles a client connecting: queues up a tree transmission,
+        /// or with deltas just an announcement of the tree version.
+        void m_handlePing();
+
+        /// @brief Queues up a full tree transmission for next time around
         void m_queueTreeSend();
 
-        /// @brief sends full path tree contents
+        /// @brief sends path tree contents or changes, as needed
         void m_sendTree();
 
         /// @brief handles updated route message from client
@@ -207,8 +220,26 @@ namespace server {
 
         /// @brief Path tree
         common::PathTree m_tree;
+        /// @brief Whether the tree has changed since it was last sent.
         util::Flag m_treeDirty;
 
+        /// @brief Whether the next tree send must be a full tree (because a
+        /// client has asked for one, or deltas were just turned on).
+        bool m_treeFullSendNeeded = true;
+
+        /// @brief Whether to send the tree (or with deltas, its version)
+        /// even if there are no changes (because a client has just
+        /// connected or asked for it).
+        bool m_treeSendNeeded = false;
+
+        /// @brief Whether to send tree changes as deltas.
+        bool m_pathTreeDeltas = false;
+
+        /// @brief The tree as last sent to clients, serialized, and (with
+        /// deltas) its version number.
+        Json::Value m_lastSentTree;
+        std::uint64_t m_treeVersion = 0;
+
         /// @brief Mutex held by anything executing in the main thread.
         mutable boost::mutex m_mainThreadMutex;
 
@@ -240,6 +271,10 @@ namespace server {
         /// @brief Number of microseconds to sleep after each loop iteration
         /// right now. 0 = no sleeping.
         int m_currentSleepTime = IDLE_SLEEP_TIME;
+
+        /// @brief Whether the sleep after each loop iteration should end
+        /// early when a device or another thread signals pending work.
+        bool m_eventDriven = false;
     };
 
     /// @brief Class to temporarily (in RAII style) change a thread ID variable
@@ -266,9 +301,12 @@ namespace server {
     inline void ServerImpl::m_callControlled(Callable f) {
         boost::unique_lock<boost::mutex> lock(m_runControl);
         if (m_running && boost::this_thread::get_id() != m_thread.get_id()) {
-            boost::unique_lock<boost::mutex> lock(m_mainThreadMutex);
-            TemporaryThreadIDChanger changer(m_mainThreadId);
-            f();
+            {
+                boost::unique_lock<boost::mutex> lock(m_mainThreadMutex);
+                TemporaryThreadIDChanger changer(m_mainThreadId);
+                f();
+            }
+            m_signalActivity();
         } else {
             f();
         }
@@ -278,9 +316,12 @@ namespace server {
     inline void ServerImpl::m_callControlled(Callable f) const {
         boost::unique_lock<boost::mutex> lock(m_runControl);
         if (m_running && boost::this_thread::get_id() != m_thread.get_id()) {
-            boost::unique_lock<boost::mutex> lock(m_mainThreadMutex);
-            TemporaryThreadIDChanger changer(m_mainThreadId);
-            f();
+            {
+                boost::unique_lock<boost::mutex> lock(m_mainThreadMutex);
+                TemporaryThreadIDChanger changer(m_mainThreadId);
+                f();
+            }
+            m_signalActivity();
         } else {
             f();
         }
@@ -0,0 +1,163 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/CompiledTransform.h>
+#include <osvr/Util/EigenInterop.h>
+#include <osvr/Util/PoseExtrapolation.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <cmath>
+
+namespace ei = osvr::util::eigen_interop;
+using osvr::common::Transform;
+using osvr::common::CompiledTransform;
+
+static OSVR_Pose3 getSamplePose() {
+    OSVR_Pose3 pose;
+    ei::map(pose).translation() = Eigen::Vector3d(0.1, -0.4, 1.5);
+    ei::map(pose).rotation() =
+        Eigen::Quaterniond(Eigen::AngleAxisd(
+            0.7, Eigen::Vector3d(0.2, 1, -0.3).normalized()));
+    return pose;
+}
+
+/// @brief Checks that the compiled transform applies to a pose and a vector
+/// the same way as the matrix math of the transform it was made from.
+static void checkMatchesTransform(Transform const &xform) {
+    CompiledTransform compiled(xform);
+    auto pose = getSamplePose();
+    OSVR_Pose3 expected;
+    ei::map(expected) = xform.transform(ei::map(pose).matrix());
+    compiled.applyToPose(pose);
+    ASSERT_TRUE(ei::map(expected).translation().isApprox(
+        ei::map(pose).translation(), 1e-9));
+    // q and -q are the same rotation.
+    ASSERT_NEAR(1., std::abs(ei::map(expected).rotation().quat().dot(
+                        ei::map(pose).rotation().quat())),
+                1e-9);
+
+    Eigen::Vector3d vec(3, -1, 0.5);
+    Transform copy(xform);
+    ASSERT_TRUE(copy.transformLinear(vec).isApprox(compiled.applyLinear(vec),
+                                                   1e-9));
+}
+
+TEST(CompiledTransform, Identity) {
+    CompiledTransform compiled;
+    ASSERT_TRUE(compiled.isIdentity());
+    auto pose = getSamplePose();
+    auto orig = pose;
+    compiled.applyToPose(pose);
+    ASSERT_TRUE(ei::map(orig).matrix().isApprox(ei::map(pose).matrix()));
+    checkMatchesTransform(Transform());
+}
+
+TEST(CompiledTransform, Rigid) {
+    Transform xform;
+    xform.concatPre(osvr::common::rotate(90, Eigen::Vector3d::UnitX()));
+    xform.concatPre(
+        Eigen::Isometry3d(Eigen::Translation3d(0, 0.05, 0.1)).matrix());
+    xform.concatPost(osvr::common::rotate(-30, Eigen::Vector3d::UnitY()));
+    xform.concatPost(
+        Eigen::Isometry3d(Eigen::Translation3d(1, 2, 3)).matrix());
+    ASSERT_TRUE(CompiledTransform(xform).isRigid());
+    ASSERT_FALSE(CompiledTransform(xform).isIdentity());
+    checkMatchesTransform(xform);
+
+    Transform roomToWorld;
+    roomToWorld.concatPost(
+        osvr::common::rotate(45, Eigen::Vector3d::UnitY()));
+    xform.transform(roomToWorld);
+    ASSERT_TRUE(CompiledTransform(xform).isRigid());
+    checkMatchesTransform(xform);
+}
+
+TEST(CompiledTransform, Reflection) {
+    Eigen::Matrix4d flip = Eigen::Matrix4d::Identity();
+    flip(2, 2) = -1;
+    Transform xform(flip, flip);
+    ASSERT_FALSE(CompiledTransform(xform).isRigid());
+    checkMatchesTransform(xform);
+}
+
+/// @brief Checks that extrapolating a pose and then transforming it agrees
+/// with transforming the pose and angular velocity and then extrapolating.
+static void checkAngularVelocityMatchesPose(Transform const &xform) {
+    CompiledTransform compiled(xform);
+    OSVR_VelocityState vel;
+    vel.linearVelocityValid = false;
+    vel.angularVelocityValid = true;
+    vel.angularVelocity.dt = 0.01;
+    ei::map(vel.angularVelocity.incrementalRotation) = Eigen::Quaterniond(
+        Eigen::AngleAxisd(0.02, Eigen::Vector3d(1, 0.5, -2).normalized()));
+    const double dt = 0.05;
+
+    auto expected = getSamplePose();
+    osvr::util::extrapolatePose(expected, vel, dt);
+    compiled.applyToPose(expected);
+
+    auto pose = getSamplePose();
+    compiled.applyToPose(pose);
+    ei::map(vel.angularVelocity.incrementalRotation) = compiled.applyLinear(
+        Eigen::Quaterniond(ei::map(vel.angularVelocity.incrementalRotation)));
+    osvr::util::extrapolatePose(pose, vel, dt);
+
+    ASSERT_NEAR(1., std::abs(ei::map(expected).rotation().quat().dot(
+                        ei::map(pose).rotation().quat())),
+                1e-9);
+}
+
+TEST(CompiledTransform, AngularVelocityIdentity) {
+    checkAngularVelocityMatchesPose(Transform());
+}
+
+TEST(CompiledTransform, AngularVelocityRotated) {
+    Transform xform;
+    xform.concatPost(osvr::common::rotate(90, Eigen::Vector3d::UnitZ()));
+    ASSERT_TRUE(CompiledTransform(xform).isRigid());
+    checkAngularVelocityMatchesPose(xform);
+
+    xform.concatPre(osvr::common::rotate(-60, Eigen::Vector3d::UnitX()));
+    xform.concatPre(
+        Eigen::Isometry3d(Eigen::Translation3d(0, 0.05, 0.1)).matrix());
+    Transform roomToWorld;
+    roomToWorld.concatPost(
+        osvr::common::rotate(45, Eigen::Vector3d::UnitY()));
+    xform.transform(roomToWorld);
+    ASSERT_TRUE(CompiledTransform(xform).isRigid());
+    checkAngularVelocityMatchesPose(xform);
+}
+
+TEST(CompiledTransform, AngularVelocityReflection) {
+    Eigen::Matrix4d flip = Eigen::Matrix4d::Identity();
+    flip(2, 2) = -1;
+    Transform xform(flip, flip);
+    ASSERT_FALSE(CompiledTransform(xform).isRigid());
+    checkAngularVelocityMatchesPose(xform);
+}
@@ -0,0 +1,116 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/IPCRingBuffer.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <cstring>
+#include <string>
+
+using osvr::common::IPCRingBuffer;
+using osvr::common::IPCRingBufferPtr;
+
+static const std::size_t ENTRY_SIZE = 4096;
+
+class IPCRingBufferTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        auto opts = IPCRingBuffer::Options(
+            std::string("osvr-test-") +
+            ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        opts.setEntries(2).setEntrySize(ENTRY_SIZE);
+        buf = IPCRingBuffer::create(opts);
+        ASSERT_TRUE(static_cast<bool>(buf));
+    }
+
+    IPCRingBuffer::sequence_type putFilled(unsigned char value) {
+        unsigned char data[ENTRY_SIZE];
+        std::memset(data, value, ENTRY_SIZE);
+        return buf->put(data, ENTRY_SIZE);
+    }
+
+    /// @brief Whether an entry was read and is entirely @p value.
+    static bool holds(IPCRingBuffer::BufferReadProxy const &entry,
+                      unsigned char value) {
+        if (!entry) {
+            return false;
+        }
+        for (std::size_t i = 0; i < ENTRY_SIZE; ++i) {
+            if (entry.get()[i] != value) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    IPCRingBufferPtr buf;
+};
+
+TEST_F(IPCRingBufferTest, PutIsPublished) {
+    auto seq = putFilled(0x11);
+    ASSERT_TRUE(holds(buf->get(seq), 0x11));
+    auto latest = buf->getLatest();
+    ASSERT_TRUE(holds(latest, 0x11));
+    ASSERT_EQ(seq, latest.getSequenceNumber());
+}
+
+TEST_F(IPCRingBufferTest, AbortedEntryIsNeverRead) {
+    auto first = putFilled(0x11);
+    IPCRingBuffer::sequence_type abortedSeq;
+    {
+        auto proxy = buf->put();
+        abortedSeq = proxy.getSequenceNumber();
+        std::memset(proxy.get(), 0xEE, ENTRY_SIZE);
+        proxy.abort();
+        ASSERT_EQ(nullptr, proxy.get());
+    }
+    ASSERT_FALSE(static_cast<bool>(buf->get(abortedSeq)));
+    auto latest = buf->getLatest();
+    ASSERT_TRUE(holds(latest, 0x11));
+    ASSERT_EQ(first, latest.getSequenceNumber());
+
+    // The next entry takes over the aborted one's sequence number.
+    ASSERT_EQ(abortedSeq, putFilled(0x22));
+    ASSERT_TRUE(holds(buf->get(abortedSeq), 0x22));
+}
+
+TEST_F(IPCRingBufferTest, AbortedEntryHidesWhatItOverwrote) {
+    // Fill both entries, so the next put reuses the oldest one's memory.
+    auto oldest = putFilled(0x11);
+    auto newest = putFilled(0x22);
+    {
+        auto proxy = buf->put();
+        std::memset(proxy.get(), 0xEE, ENTRY_SIZE / 2);
+        proxy.abort();
+    }
+    // Half-overwritten, so the old entry must not be readable either.
+    ASSERT_FALSE(static_cast<bool>(buf->get(oldest)));
+    ASSERT_TRUE(holds(buf->get(newest), 0x22));
+    ASSERT_TRUE(holds(buf->getLatest(), 0x22));
+}
@@ -0,0 +1,159 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/ImagingWireFormat.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+// - none
+
+using osvr::common::ImageBytes;
+using osvr::common::ImageWireEncoding;
+using osvr::common::NetworkImagingOptions;
+using osvr::common::encodeImageForWire;
+using osvr::common::decodeImageFromWire;
+using osvr::common::extractImageRegion;
+
+static OSVR_ImagingMetadata getMetadata(OSVR_ImageDimension width,
+                                        OSVR_ImageDimension height) {
+    OSVR_ImagingMetadata meta;
+    meta.width = width;
+    meta.height = height;
+    meta.channels = 1;
+    meta.depth = 1;
+    meta.type = OSVR_IVT_UNSIGNED_INT;
+    return meta;
+}
+
+/// @brief A frame with a dark background and a few bright spots, like an
+/// IR tracking camera's.
+static ImageBytes getFrame(OSVR_ImagingMetadata const &meta, int shift) {
+    ImageBytes ret(meta.width * meta.height, 8);
+    for (int spot = 0; spot < 5; ++spot) {
+        auto x = (spot * 37 + shift) % meta.width;
+        auto y = (spot * 23) % meta.height;
+        ret[y * meta.width + x] = 250;
+    }
+    return ret;
+}
+
+/// @brief Encodes then decodes, checking that the result is the input.
+static ImageWireEncoding checkRoundtrip(ImageBytes const &image,
+                                        ImageBytes const *previous) {
+    ImageBytes encoded;
+    auto encoding = encodeImageForWire(image, previous, encoded);
+    ImageBytes decoded(image.size());
+    EXPECT_TRUE(decodeImageFromWire(encoding, encoded.data(), encoded.size(),
+                                    previous, decoded));
+    EXPECT_EQ(image, decoded);
+    return encoding;
+}
+
+TEST(ImagingWireFormat, RunLengthRoundtrip) {
+    auto meta = getMetadata(640, 480);
+    auto frame = getFrame(meta, 0);
+    ImageBytes encoded;
+    ASSERT_EQ(ImageWireEncoding::RunLength,
+              encodeImageForWire(frame, nullptr, encoded));
+    ASSERT_LT(encoded.size(), frame.size() / 50);
+    ASSERT_EQ(ImageWireEncoding::RunLength, checkRoundtrip(frame, nullptr));
+}
+
+TEST(ImagingWireFormat, DeltaRoundtrip) {
+    auto meta = getMetadata(640, 480);
+    auto first = getFrame(meta, 0);
+    auto second = getFrame(meta, 3);
+    ASSERT_EQ(ImageWireEncoding::DeltaRunLength,
+              checkRoundtrip(second, &first));
+
+    ImageBytes decoded(second.size());
+    ImageBytes encoded;
+    encodeImageForWire(second, &first, encoded);
+    ASSERT_FALSE(decodeImageFromWire(ImageWireEncoding::DeltaRunLength,
+                                     encoded.data(), encoded.size(), nullptr,
+                                     decoded));
+}
+
+TEST(ImagingWireFormat, IncompressibleFallsBackToRaw) {
+    ImageBytes noise(1000);
+    unsigned state = 1;
+    for (auto &px : noise) {
+        state = state * 1103515245u + 12345u;
+        px = static_cast<OSVR_ImageBufferElement>(state >> 16);
+    }
+    ASSERT_EQ(ImageWireEncoding::Raw, checkRoundtrip(noise, nullptr));
+}
+
+TEST(ImagingWireFormat, MalformedDataRejected) {
+    ImageBytes decoded(10);
+    // A run longer than the output
+    OSVR_ImageBufferElement run[] = {200, 1};
+    ASSERT_FALSE(decodeImageFromWire(ImageWireEncoding::RunLength, run,
+                                     sizeof(run), nullptr, decoded));
+    // A literal missing its bytes
+    OSVR_ImageBufferElement literal[] = {5, 1, 2};
+    ASSERT_FALSE(decodeImageFromWire(ImageWireEncoding::RunLength, literal,
+                                     sizeof(literal), nullptr, decoded));
+}
+
+TEST(ImagingWireFormat, RegionAndDownscale) {
+    auto meta = getMetadata(8, 6);
+    ImageBytes image(meta.width * meta.height);
+    for (std::size_t i = 0; i < image.size(); ++i) {
+        image[i] = static_cast<OSVR_ImageBufferElement>(i);
+    }
+
+    ImageBytes out;
+    NetworkImagingOptions opts;
+    auto outMeta = extractImageRegion(meta, image.data(), opts, out);
+    ASSERT_EQ(meta.width, outMeta.width);
+    ASSERT_EQ(meta.height, outMeta.height);
+    ASSERT_EQ(image, out);
+
+    opts.roiX = 2;
+    opts.roiY = 1;
+    opts.roiWidth = 3;
+    opts.roiHeight = 2;
+    outMeta = extractImageRegion(meta, image.data(), opts, out);
+    ASSERT_EQ(3u, outMeta.width);
+    ASSERT_EQ(2u, outMeta.height);
+    ASSERT_EQ((ImageBytes{10, 11, 12, 18, 19, 20}), out);
+
+    opts.downscale = 2;
+    outMeta = extractImageRegion(meta, image.data(), opts, out);
+    ASSERT_EQ(2u, outMeta.width);
+    ASSERT_EQ(1u, outMeta.height);
+    ASSERT_EQ((ImageBytes{10, 12}), out);
+
+    // Region entirely outside the image: falls back to the whole image.
+    opts = NetworkImagingOptions{};
+    opts.roiX = 100;
+    outMeta = extractImageRegion(meta, image.data(), opts, out);
+    ASSERT_EQ(meta.width, outMeta.width);
+    ASSERT_EQ(image, out);
+}
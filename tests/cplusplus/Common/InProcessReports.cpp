@@ -0,0 +1,208 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/InProcessReports.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <vector>
+
+using osvr::common::InProcessReports;
+using osvr::common::InProcessTrackerChannel;
+using osvr::common::TrackerReportListener;
+using osvr::util::time::TimeValue;
+
+namespace {
+class RecordingListener : public TrackerReportListener {
+  public:
+    void handlePose(OSVR_ChannelCount sensor, OSVR_PoseState const &pose,
+                    TimeValue const &timestamp) override {
+        poseSensors.push_back(sensor);
+        lastX = pose.translation.data[0];
+        lastTime = timestamp;
+    }
+    void handleVelocity(OSVR_ChannelCount sensor, OSVR_VelocityState const &,
+                        TimeValue const &) override {
+        velSensors.push_back(sensor);
+    }
+    void handleAcceleration(OSVR_ChannelCount sensor,
+                            OSVR_AccelerationState const &,
+                            TimeValue const &) override {
+        accelSensors.push_back(sensor);
+    }
+    std::vector<OSVR_ChannelCount> poseSensors;
+    std::vector<OSVR_ChannelCount> velSensors;
+    std::vector<OSVR_ChannelCount> accelSensors;
+    double lastX = 0;
+    TimeValue lastTime = {0, 0};
+};
+
+OSVR_PoseState makePose(double x) {
+    OSVR_PoseState pose = {};
+    pose.translation.data[0] = x;
+    pose.rotation.data[0] = 1;
+    return pose;
+}
+} // namespace
+
+TEST(InProcessReports, ChannelsAreStablePerDevice) {
+    InProcessReports reports;
+    auto &a = reports.getTrackerChannel("org_osvr_example/Tracker");
+    auto &b = reports.getTrackerChannel("org_osvr_example/Other");
+    ASSERT_NE(&a, &b);
+    for (int i = 0; i < 100; ++i) {
+        reports.getTrackerChannel("org_osvr_example/Tracker" +
+                                  std::to_string(i));
+    }
+    ASSERT_EQ(&a, &reports.getTrackerChannel("org_osvr_example/Tracker"));
+}
+
+TEST(InProcessReports, PublisherCount) {
+    InProcessReports reports;
+    auto &channel = reports.getTrackerChannel("dev");
+    ASSERT_FALSE(channel.hasPublisher());
+    channel.attachPublisher();
+    channel.attachPublisher();
+    ASSERT_TRUE(channel.hasPublisher());
+    channel.detachPublisher();
+    ASSERT_TRUE(channel.hasPublisher());
+    channel.detachPublisher();
+    ASSERT_FALSE(channel.hasPublisher());
+}
+
+TEST(InProcessReports, DeliversToEachListener) {
+    InProcessReports reports;
+    auto &channel = reports.getTrackerChannel("dev");
+    ASSERT_FALSE(channel.hasListeners());
+    RecordingListener first;
+    RecordingListener second;
+    channel.addListener(first);
+    channel.addListener(second);
+    ASSERT_TRUE(channel.hasListeners());
+
+    TimeValue when = {12, 345};
+    channel.publishPose(1, makePose(2.5), when);
+    channel.publishVelocity(0, OSVR_VelocityState{}, when);
+    channel.publishAcceleration(3, OSVR_AccelerationState{}, when);
+    for (auto listener : {&first, &second}) {
+        ASSERT_EQ(1u, listener->poseSensors.size());
+        ASSERT_EQ(1u, listener->poseSensors[0]);
+        ASSERT_EQ(2.5, listener->lastX);
+        ASSERT_EQ(12, listener->lastTime.seconds);
+        ASSERT_EQ(345, listener->lastTime.microseconds);
+        ASSERT_EQ(1u, listener->velSensors.size());
+        ASSERT_EQ(0u, listener->velSensors[0]);
+        ASSERT_EQ(1u, listener->accelSensors.size());
+        ASSERT_EQ(3u, listener->accelSensors[0]);
+    }
+}
+
+TEST(InProcessReports, RemovedListenersHearNothing) {
+    InProcessReports reports;
+    auto &channel = reports.getTrackerChannel("dev");
+    RecordingListener kept;
+    RecordingListener removed;
+    channel.addListener(removed);
+    channel.addListener(kept);
+    channel.removeListener(removed);
+    channel.publishPose(0, makePose(1), TimeValue{1, 0});
+    ASSERT_EQ(1u, kept.poseSensors.size());
+    ASSERT_TRUE(removed.poseSensors.empty());
+    channel.removeListener(kept);
+    ASSERT_FALSE(channel.hasListeners());
+}
+
+namespace {
+/// @brief Removes a listener (by default, itself) upon hearing a pose.
+class Remover : public RecordingListener {
+  public:
+    explicit Remover(InProcessTrackerChannel &channel)
+        : m_channel(channel), m_victim(this) {}
+    Remover(InProcessTrackerChannel &channel, TrackerReportListener &victim)
+        : m_channel(channel), m_victim(&victim) {}
+    void handlePose(OSVR_ChannelCount sensor, OSVR_PoseState const &pose,
+                    TimeValue const &timestamp) override {
+        RecordingListener::handlePose(sensor, pose, timestamp);
+        m_channel.removeListener(*m_victim);
+    }
+
+  private:
+    InProcessTrackerChannel &m_channel;
+    TrackerReportListener *m_victim;
+};
+} // namespace
+
+TEST(InProcessReports, ListenerMayRemoveItselfWhileHearing) {
+    InProcessReports reports;
+    auto &channel = reports.getTrackerChannel("dev");
+    Remover once(channel);
+    channel.addListener(once);
+    channel.publishPose(0, makePose(1), TimeValue{1, 0});
+    channel.publishPose(0, makePose(2), TimeValue{2, 0});
+    ASSERT_EQ(1u, once.poseSensors.size());
+    ASSERT_EQ(1, once.lastX);
+}
+
+TEST(InProcessReports, RemovalWhileHearingSkipsNoOthers) {
+    InProcessReports reports;
+    auto &channel = reports.getTrackerChannel("dev");
+    Remover once(channel);
+    RecordingListener after;
+    channel.addListener(once);
+    channel.addListener(after);
+    channel.publishPose(0, makePose(1), TimeValue{1, 0});
+    ASSERT_EQ(1u, once.poseSensors.size());
+    ASSERT_EQ(1u, after.poseSensors.size());
+    channel.publishPose(0, makePose(2), TimeValue{2, 0});
+    ASSERT_EQ(1u, once.poseSensors.size());
+    ASSERT_EQ(2u, after.poseSensors.size());
+}
+
+TEST(InProcessReports, ListenerRemovedWhileOthersHearHearsNothing) {
+    InProcessReports reports;
+    auto &channel = reports.getTrackerChannel("dev");
+    RecordingListener victim;
+    Remover remover(channel, victim);
+    channel.addListener(remover);
+    channel.addListener(victim);
+    channel.publishPose(0, makePose(1), TimeValue{1, 0});
+    ASSERT_EQ(1u, remover.poseSensors.size());
+    ASSERT_TRUE(victim.poseSensors.empty());
+    channel.publishPose(0, makePose(2), TimeValue{2, 0});
+    ASSERT_EQ(2u, remover.poseSensors.size());
+    ASSERT_TRUE(victim.poseSensors.empty());
+}
+
+TEST(InProcessReports, DevicesAreSeparate) {
+    InProcessReports reports;
+    RecordingListener listener;
+    reports.getTrackerChannel("a").addListener(listener);
+    reports.getTrackerChannel("b").publishPose(0, makePose(1), TimeValue{});
+    ASSERT_TRUE(listener.poseSensors.empty());
+    reports.getTrackerChannel("a").publishPose(0, makePose(1), TimeValue{});
+    ASSERT_EQ(1u, listener.poseSensors.size());
+}
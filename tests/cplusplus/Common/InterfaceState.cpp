@@ -0,0 +1,119 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/InterfaceState.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+// - none
+
+using osvr::common::InterfaceState;
+using osvr::common::MotionState;
+
+static OSVR_TimeValue makeTime(OSVR_TimeValue_Seconds seconds) {
+    OSVR_TimeValue ret;
+    ret.seconds = seconds;
+    ret.microseconds = 500;
+    return ret;
+}
+
+static OSVR_PoseReport makePoseReport(double x) {
+    OSVR_PoseReport report;
+    report.sensor = 0;
+    report.pose.translation.data[0] = x;
+    report.pose.translation.data[1] = 0;
+    report.pose.translation.data[2] = 0;
+    report.pose.rotation.data[0] = 1;
+    report.pose.rotation.data[1] = 0;
+    report.pose.rotation.data[2] = 0;
+    report.pose.rotation.data[3] = 0;
+    return report;
+}
+
+static OSVR_VelocityReport makeVelocityReport(double x) {
+    OSVR_VelocityReport report;
+    report.sensor = 0;
+    report.state.linearVelocityValid = true;
+    report.state.linearVelocity.data[0] = x;
+    report.state.linearVelocity.data[1] = 0;
+    report.state.linearVelocity.data[2] = 0;
+    report.state.angularVelocityValid = false;
+    return report;
+}
+
+TEST(InterfaceState, NoMotionInitially) {
+    InterfaceState state;
+    MotionState motion;
+    ASSERT_FALSE(state.getMotionState(motion));
+}
+
+TEST(InterfaceState, MotionTracksPoseAndVelocity) {
+    InterfaceState state;
+    MotionState motion;
+    state.setStateFromReport(makeTime(1), makePoseReport(1));
+    ASSERT_TRUE(state.getMotionState(motion));
+    ASSERT_TRUE(motion.hasPose);
+    ASSERT_FALSE(motion.hasVelocity);
+    ASSERT_EQ(1, motion.poseTimestamp.seconds);
+    ASSERT_EQ(1, motion.pose.translation.data[0]);
+
+    state.setStateFromReport(makeTime(2), makeVelocityReport(5));
+    state.setStateFromReport(makeTime(3), makePoseReport(3));
+    ASSERT_TRUE(state.getMotionState(motion));
+    ASSERT_TRUE(motion.hasPose);
+    ASSERT_TRUE(motion.hasVelocity);
+    ASSERT_EQ(3, motion.poseTimestamp.seconds);
+    ASSERT_EQ(3, motion.pose.translation.data[0]);
+    ASSERT_EQ(2, motion.velocityTimestamp.seconds);
+    ASSERT_EQ(5, motion.velocity.linearVelocity.data[0]);
+}
+
+TEST(InterfaceState, MotionIgnoresOtherReports) {
+    InterfaceState state;
+    MotionState motion;
+    OSVR_PositionReport report;
+    report.sensor = 0;
+    report.xyz.data[0] = report.xyz.data[1] = report.xyz.data[2] = 0;
+    state.setStateFromReport(makeTime(1), report);
+    ASSERT_TRUE(state.hasAnyState());
+    ASSERT_FALSE(state.getMotionState(motion));
+}
+
+TEST(InterfaceState, MotionMatchesIndividualState) {
+    InterfaceState state;
+    state.setStateFromReport(makeTime(2), makePoseReport(2));
+    // Out of order, so dropped from both.
+    state.setStateFromReport(makeTime(1), makePoseReport(1));
+    MotionState motion;
+    ASSERT_TRUE(state.getMotionState(motion));
+    OSVR_TimeValue timestamp;
+    OSVR_PoseState pose;
+    ASSERT_TRUE(state.getState<OSVR_PoseReport>(timestamp, pose));
+    ASSERT_EQ(timestamp.seconds, motion.poseTimestamp.seconds);
+    ASSERT_EQ(pose.translation.data[0], motion.pose.translation.data[0]);
+    ASSERT_EQ(2, motion.pose.translation.data[0]);
+}
@@ -0,0 +1,235 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "DummyTree.h"
+#include <osvr/Common/PathTreeSerialization.h>
+#include <osvr/Common/PathTreeOwner.h>
+#include <osvr/Common/PathElementTools.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <algorithm>
+#include <cstdint>
+
+namespace common = osvr::common;
+using osvr::common::PathTree;
+using namespace osvr::common::elements;
+
+/// @brief Applies the delta from oldTree to newTree to a copy of oldTree (made
+/// through JSON) and checks that the result matches newTree.
+static void checkRoundtrip(PathTree &oldTree, PathTree &newTree) {
+    auto oldNodes = common::pathTreeToJson(oldTree);
+    auto newNodes = common::pathTreeToJson(newTree);
+    auto delta = common::diffPathTreeJson(oldNodes, newNodes);
+
+    PathTree patched;
+    common::jsonToPathTree(patched, oldNodes);
+    common::applyPathTreeDelta(patched, delta);
+    ASSERT_TRUE(common::isPathTreeDeltaEmpty(
+        common::diffPathTreeJson(common::pathTreeToJson(patched), newNodes)));
+
+    // Including null nodes, it should match what a full tree would produce.
+    PathTree replaced;
+    common::jsonToPathTree(replaced, newNodes);
+    ASSERT_EQ(common::pathTreeToJson(replaced, true),
+              common::pathTreeToJson(patched, true));
+}
+
+TEST(PathTreeDelta, IdenticalTreesGiveEmptyDelta) {
+    PathTree tree;
+    dummy::setupDummyTree(tree);
+    auto nodes = common::pathTreeToJson(tree);
+    ASSERT_TRUE(
+        common::isPathTreeDeltaEmpty(common::diffPathTreeJson(nodes, nodes)));
+}
+
+TEST(PathTreeDelta, AddedNode) {
+    PathTree oldTree;
+    dummy::setupDummyDevice(oldTree);
+    PathTree newTree;
+    dummy::setupDummyTree(newTree);
+
+    auto delta = common::diffPathTreeJson(common::pathTreeToJson(oldTree),
+                                          common::pathTreeToJson(newTree));
+    ASSERT_EQ(1u, delta["added"].size());
+    ASSERT_EQ(dummy::getAlias(), delta["added"][0]["path"].asString());
+    ASSERT_EQ(0u, delta["changed"].size());
+    ASSERT_EQ(0u, delta["removed"].size());
+    checkRoundtrip(oldTree, newTree);
+}
+
+TEST(PathTreeDelta, RemovedNode) {
+    PathTree oldTree;
+    dummy::setupDummyTree(oldTree);
+    PathTree newTree;
+    dummy::setupDummyDevice(newTree);
+
+    auto delta = common::diffPathTreeJson(common::pathTreeToJson(oldTree),
+                                          common::pathTreeToJson(newTree));
+    ASSERT_EQ(0u, delta["added"].size());
+    ASSERT_EQ(0u, delta["changed"].size());
+    ASSERT_EQ(1u, delta["removed"].size());
+    ASSERT_EQ(dummy::getAlias(), delta["removed"][0].asString());
+    checkRoundtrip(oldTree, newTree);
+}
+
+TEST(PathTreeDelta, ChangedNode) {
+    PathTree oldTree;
+    dummy::setupDummyTree(oldTree);
+    PathTree newTree;
+    dummy::setupDummyDevice(newTree);
+    newTree.getNodeByPath(dummy::getAlias(),
+                          AliasElement(dummy::getInterfacePath() + "/0"));
+
+    auto delta = common::diffPathTreeJson(common::pathTreeToJson(oldTree),
+                                          common::pathTreeToJson(newTree));
+    ASSERT_EQ(0u, delta["added"].size());
+    ASSERT_EQ(1u, delta["changed"].size());
+    ASSERT_EQ(dummy::getAlias(), delta["changed"][0]["path"].asString());
+    ASSERT_EQ(0u, delta["removed"].size());
+    checkRoundtrip(oldTree, newTree);
+}
+
+TEST(PathTreeDelta, RemovedNodeIsPruned) {
+    PathTree oldTree;
+    dummy::setupDummyTree(oldTree);
+    PathTree newTree;
+    dummy::setupDummyDevice(newTree);
+    auto delta = common::diffPathTreeJson(common::pathTreeToJson(oldTree),
+                                          common::pathTreeToJson(newTree));
+
+    auto pruned = common::applyPathTreeDelta(oldTree, delta);
+    // The alias, and the otherwise-empty nodes above it.
+    ASSERT_EQ(3u, pruned.size());
+    ASSERT_EQ(dummy::getAlias(), pruned[0]);
+    ASSERT_EQ("/me", pruned[2]);
+    PathTree const &tree = oldTree;
+    ASSERT_THROW(tree.getNodeByPath("/me"), osvr::util::tree::NoSuchChild);
+    ASSERT_NO_THROW(tree.getNodeByPath(dummy::getInterfacePath()));
+}
+
+TEST(PathTreeDelta, RemovedNodeWithChildrenIsKept) {
+    PathTree oldTree;
+    dummy::setupDummyTree(oldTree);
+    oldTree.getNodeByPath("/me/hands", AliasElement(getFullSourcePath()));
+    PathTree newTree;
+    dummy::setupDummyTree(newTree);
+    auto delta = common::diffPathTreeJson(common::pathTreeToJson(oldTree),
+                                          common::pathTreeToJson(newTree));
+    ASSERT_EQ(1u, delta["removed"].size());
+
+    auto pruned = common::applyPathTreeDelta(oldTree, delta);
+    ASSERT_TRUE(pruned.empty());
+    ASSERT_TRUE(common::elements::isNull(oldTree.getNodeByPath("/me/hands").value()));
+    checkRoundtrip(oldTree, newTree);
+}
+
+/// @brief Makes the message a server sends with a full tree.
+static Json::Value makeFullTreeMessage(PathTree &tree, std::uint64_t version) {
+    Json::Value ret(Json::objectValue);
+    ret["version"] = Json::UInt64(version);
+    ret["nodes"] = common::pathTreeToJson(tree);
+    return ret;
+}
+
+static Json::Value makeStampMessage(std::uint64_t version) {
+    Json::Value ret(Json::objectValue);
+    ret["version"] = Json::UInt64(version);
+    return ret;
+}
+
+TEST(PathTreeOwner, StampWithoutTreeRequestsOne) {
+    common::PathTreeOwner owner;
+    ASSERT_FALSE(owner.applyTreeDelta(makeStampMessage(1)));
+    ASSERT_FALSE(static_cast<bool>(owner));
+}
+
+TEST(PathTreeOwner, FullTreeOnlyAppliedIfNewer) {
+    PathTree tree;
+    dummy::setupDummyTree(tree);
+    common::PathTreeOwner owner;
+    ASSERT_TRUE(owner.applyTreeDelta(makeFullTreeMessage(tree, 3)));
+    ASSERT_TRUE(static_cast<bool>(owner));
+    ASSERT_TRUE(owner.applyTreeDelta(makeStampMessage(3)));
+    auto generation = owner.getGeneration();
+
+    // Another client asked for the same tree again: nothing to do.
+    ASSERT_TRUE(owner.applyTreeDelta(makeFullTreeMessage(tree, 3)));
+    ASSERT_EQ(generation, owner.getGeneration());
+
+    ASSERT_FALSE(owner.applyTreeDelta(makeStampMessage(4)));
+    ASSERT_TRUE(owner.applyTreeDelta(makeFullTreeMessage(tree, 4)));
+    ASSERT_NE(generation, owner.getGeneration());
+    ASSERT_TRUE(owner.applyTreeDelta(makeStampMessage(4)));
+}
+
+TEST(PathTreeOwner, MismatchedDeltaRequestsFullTree) {
+    PathTree oldTree;
+    dummy::setupDummyDevice(oldTree);
+    PathTree newTree;
+    dummy::setupDummyTree(newTree);
+    auto delta = common::diffPathTreeJson(common::pathTreeToJson(oldTree),
+                                          common::pathTreeToJson(newTree));
+
+    common::PathTreeOwner owner;
+    ASSERT_TRUE(owner.applyTreeDelta(makeFullTreeMessage(oldTree, 1)));
+
+    auto skipped = delta;
+    skipped["baseVersion"] = Json::UInt64(2);
+    skipped["version"] = Json::UInt64(3);
+    ASSERT_FALSE(owner.applyTreeDelta(skipped));
+    // Nothing more can apply until the full tree comes in.
+    delta["baseVersion"] = Json::UInt64(1);
+    delta["version"] = Json::UInt64(2);
+    ASSERT_FALSE(owner.applyTreeDelta(delta));
+
+    ASSERT_TRUE(owner.applyTreeDelta(makeFullTreeMessage(newTree, 3)));
+    ASSERT_TRUE(owner.applyTreeDelta(makeStampMessage(3)));
+}
+
+TEST(PathTreeOwner, DeltaApplied) {
+    PathTree oldTree;
+    dummy::setupDummyTree(oldTree);
+    PathTree newTree;
+    dummy::setupDummyDevice(newTree);
+    auto delta = common::diffPathTreeJson(common::pathTreeToJson(oldTree),
+                                          common::pathTreeToJson(newTree));
+    delta["baseVersion"] = Json::UInt64(1);
+    delta["version"] = Json::UInt64(2);
+
+    common::PathTreeOwner owner;
+    ASSERT_TRUE(owner.applyTreeDelta(makeFullTreeMessage(oldTree, 1)));
+    auto generation = owner.getGeneration();
+    ASSERT_TRUE(owner.applyTreeDelta(delta));
+    ASSERT_EQ(generation, owner.getGeneration());
+    ASSERT_TRUE(owner.applyTreeDelta(makeStampMessage(2)));
+    PathTree const &tree = owner.get();
+    ASSERT_THROW(tree.getNodeByPath("/me"), osvr::util::tree::NoSuchChild);
+    auto const &paths = owner.getLastDeltaPaths();
+    ASSERT_TRUE(std::find(begin(paths), end(paths), "/me") != end(paths));
+}
@@ -26,6 +26,7 @@
 // Internal Includes
 #include "DummyTree.h"
 #include <osvr/Common/ResolveTreeNode.h>
+#include <osvr/Common/ResolvedSourceCache.h>
 
 // Library/third-party includes
 #include "gtest/gtest.h"
@@ -91,4 +92,44 @@ TEST_F(PathTreeResolution, BackCompatRoute) {
 
     setAlias(val.toStyledString());
     checkResolution();
-}
\ No newline at end of file
+}
+
+TEST_F(PathTreeResolution, CachedResolution) {
+    dummy::setupRawAlias(tree);
+    common::ResolvedSourceCache cache;
+    ASSERT_FALSE(cache.contains(dummy::getAlias()));
+    auto const &cached = cache.resolve(tree, dummy::getAlias());
+    ASSERT_TRUE(cached.is_initialized());
+    ASSERT_EQ(cached->getDevicePath(), dummy::getDevicePath());
+    ASSERT_TRUE(cache.contains(dummy::getAlias()));
+
+    // Nodes the resolution didn't pass through don't invalidate it.
+    ASSERT_EQ(0u, cache.invalidate(dummy::getInterfacePath() + "/0"));
+    ASSERT_EQ(0u, cache.invalidate("/me/hands/right"));
+    ASSERT_TRUE(cache.contains(dummy::getAlias()));
+
+    // The alias itself, the sensor it lands on, and the device that sensor is
+    // under all do.
+    ASSERT_EQ(1u, cache.invalidate(dummy::getAlias()));
+    ASSERT_FALSE(cache.contains(dummy::getAlias()));
+    cache.resolve(tree, dummy::getAlias());
+    ASSERT_EQ(1u, cache.invalidate(dummy::getFullSourcePath()));
+    cache.resolve(tree, dummy::getAlias());
+    ASSERT_EQ(1u, cache.invalidate(dummy::getDevicePath()));
+    ASSERT_FALSE(cache.contains(dummy::getAlias()));
+
+    // Unresolvable results are cached too, until what they depend on changes.
+    std::string const pending = "/me/head";
+    tree.getNodeByPath(dummy::getAlias()).value() =
+        common::elements::AliasElement(pending);
+    cache.invalidate(dummy::getAlias());
+    ASSERT_FALSE(cache.resolve(tree, dummy::getAlias()).is_initialized());
+    ASSERT_TRUE(cache.contains(dummy::getAlias()));
+    tree.getNodeByPath(pending, common::elements::AliasElement(
+                                    dummy::getFullSourcePath()));
+    ASSERT_EQ(1u, cache.invalidate(pending));
+    ASSERT_TRUE(cache.resolve(tree, dummy::getAlias()).is_initialized());
+
+    cache.clear();
+    ASSERT_FALSE(cache.contains(dummy::getAlias()));
+}
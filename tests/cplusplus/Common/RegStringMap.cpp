@@ -150,3 +150,20 @@ TEST_F(RegisteredStringMapTest, checkSetupPeerMappings) {
     ASSERT_STREQ("RegVal1", corMap.getStringFromId(corID4).c_str());
     ASSERT_STREQ("RegVal2", corMap.getStringFromId(corID5).c_str());
 }
+
+TEST(RegisteredStringMap, manyEntriesKeepStableIds) {
+    static const uint32_t COUNT = 5000;
+    RegisteredStringMap regMap;
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        ASSERT_EQ(i, regMap.getStringID("/dev/" + std::to_string(i)).value());
+    }
+    regMap.clearModifiedFlag();
+    // Looking everything up again, after the index has grown several times,
+    // must neither add entries nor change any ID.
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        ASSERT_EQ(i, regMap.getStringID("/dev/" + std::to_string(i)).value());
+    }
+    ASSERT_FALSE(regMap.isModified());
+    ASSERT_EQ(COUNT, regMap.getEntries().size());
+    ASSERT_EQ("/dev/1234", regMap.getStringFromId(StringID(1234)));
+}
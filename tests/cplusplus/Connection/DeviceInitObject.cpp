@@ -0,0 +1,63 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Connection/DeviceInitObject.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+// - none
+
+using osvr::connection::ConnectionPtr;
+
+TEST(DeviceInitObject, noQueueByDefault) {
+    OSVR_DeviceInitObject init{ConnectionPtr()};
+    ASSERT_EQ(0, init.getSendQueueCapacity());
+    ASSERT_EQ(0, init.getSendBatchMaxLatency());
+}
+
+TEST(DeviceInitObject, explicitQueueCapacity) {
+    OSVR_DeviceInitObject init{ConnectionPtr()};
+    init.setSendQueueCapacity(32);
+    ASSERT_EQ(32, init.getSendQueueCapacity());
+}
+
+TEST(DeviceInitObject, batchingAloneImpliesQueue) {
+    // Devices that send directly on the connection (and analysis plugins fed
+    // in process) decide based on this, so it must match whether the async
+    // token will queue - which batching always does.
+    OSVR_DeviceInitObject init{ConnectionPtr()};
+    init.setSendBatchMaxLatency(2000);
+    ASSERT_GT(init.getSendQueueCapacity(), 0);
+}
+
+TEST(DeviceInitObject, batchingKeepsExplicitQueueCapacity) {
+    OSVR_DeviceInitObject init{ConnectionPtr()};
+    init.setSendQueueCapacity(4);
+    init.setSendBatchMaxLatency(2000);
+    ASSERT_EQ(4, init.getSendQueueCapacity());
+}
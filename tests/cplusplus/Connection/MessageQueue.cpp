@@ -0,0 +1,169 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "../../../src/osvr/Connection/MessageQueue.h"
+#include "../../../src/osvr/Connection/MessageQueue.cpp"
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+#include <boost/thread/thread.hpp>
+
+// Standard includes
+#include <cstring>
+#include <vector>
+
+using namespace osvr::connection;
+using osvr::util::time::TimeValue;
+
+/// @brief Never dereferenced - just something to compare against.
+static MessageType *const dummyType = reinterpret_cast<MessageType *>(0x10);
+
+static TimeValue makeTime(int i) {
+    TimeValue ret;
+    ret.seconds = i;
+    ret.microseconds = 0;
+    return ret;
+}
+
+TEST(MessageQueue, emptyDrainsNothing) {
+    MessageQueue q(4);
+    ASSERT_EQ(4, q.capacity());
+    auto handled =
+        q.drain([](TimeValue const &, MessageType *, const char *, size_t) {
+            FAIL() << "Should not be called on an empty queue";
+        });
+    ASSERT_EQ(0, handled);
+    ASSERT_EQ(0, q.getOverflowCount());
+}
+
+TEST(MessageQueue, fifoWithContents) {
+    MessageQueue q(4);
+    for (int i = 0; i < 3; ++i) {
+        char buf[] = {char('a' + i), char('A' + i)};
+        ASSERT_TRUE(q.push(makeTime(i), dummyType, buf, sizeof(buf)));
+    }
+    int expected = 0;
+    auto handled = q.drain([&](TimeValue const &ts, MessageType *type,
+                               const char *buf, size_t len) {
+        ASSERT_EQ(expected, ts.seconds);
+        ASSERT_EQ(dummyType, type);
+        ASSERT_EQ(2, len);
+        ASSERT_EQ('a' + expected, buf[0]);
+        ASSERT_EQ('A' + expected, buf[1]);
+        ++expected;
+    });
+    ASSERT_EQ(3, handled);
+    ASSERT_EQ(3, expected);
+}
+
+TEST(MessageQueue, pushBufferSwapsWithoutCopying) {
+    MessageQueue q(2);
+    std::vector<char> buf(1000, 'x');
+    const char *original = buf.data();
+    ASSERT_TRUE(q.pushBuffer(makeTime(1), dummyType, buf));
+    ASSERT_TRUE(buf.empty());
+    auto handled = q.drain([&](TimeValue const &ts, MessageType *type,
+                               const char *data, size_t len) {
+        ASSERT_EQ(1, ts.seconds);
+        ASSERT_EQ(dummyType, type);
+        ASSERT_EQ(1000, len);
+        // Same storage we handed in.
+        ASSERT_EQ(original, data);
+    });
+    ASSERT_EQ(1, handled);
+
+    // Fill it, then make sure a rejected buffer is left alone.
+    std::vector<char> other(10, 'y');
+    ASSERT_TRUE(q.pushBuffer(makeTime(2), dummyType, other));
+    other.assign(10, 'y');
+    ASSERT_TRUE(q.pushBuffer(makeTime(3), dummyType, other));
+    other.assign(10, 'z');
+    ASSERT_FALSE(q.pushBuffer(makeTime(4), dummyType, other));
+    ASSERT_EQ(10, other.size());
+    ASSERT_EQ('z', other[0]);
+    ASSERT_EQ(1, q.getOverflowCount());
+}
+
+TEST(MessageQueue, overflowDropsNewest) {
+    MessageQueue q(2);
+    const char buf[] = "x";
+    ASSERT_TRUE(q.push(makeTime(0), dummyType, buf, 1));
+    ASSERT_TRUE(q.push(makeTime(1), dummyType, buf, 1));
+    ASSERT_FALSE(q.push(makeTime(2), dummyType, buf, 1));
+    ASSERT_EQ(1, q.getOverflowCount());
+
+    std::vector<int> seen;
+    q.drain([&](TimeValue const &ts, MessageType *, const char *, size_t) {
+        seen.push_back(static_cast<int>(ts.seconds));
+    });
+    ASSERT_EQ(2, seen.size());
+    ASSERT_EQ(0, seen[0]);
+    ASSERT_EQ(1, seen[1]);
+
+    // Room again after draining.
+    ASSERT_TRUE(q.push(makeTime(3), dummyType, buf, 1));
+}
+
+TEST(MessageQueue, drainLimit) {
+    MessageQueue q(8);
+    const char buf[] = "x";
+    for (int i = 0; i < 5; ++i) {
+        q.push(makeTime(i), dummyType, buf, 1);
+    }
+    auto noop = [](TimeValue const &, MessageType *, const char *, size_t) {};
+    ASSERT_EQ(2, q.drain(noop, 2));
+    ASSERT_EQ(3, q.drain(noop));
+    ASSERT_EQ(0, q.drain(noop));
+}
+
+TEST(MessageQueue, threadedProducer) {
+    static const int MESSAGES = 10000;
+    MessageQueue q(64);
+    boost::thread producer([&] {
+        for (int i = 0; i < MESSAGES; ++i) {
+            char buf[sizeof(int)];
+            std::memcpy(buf, &i, sizeof(int));
+            while (!q.push(makeTime(i), dummyType, buf, sizeof(buf))) {
+                boost::this_thread::yield();
+            }
+        }
+    });
+    int expected = 0;
+    bool inOrder = true;
+    while (expected < MESSAGES) {
+        q.drain([&](TimeValue const &ts, MessageType *, const char *buf,
+                    size_t len) {
+            int val;
+            std::memcpy(&val, buf, sizeof(int));
+            inOrder = inOrder && (len == sizeof(int)) && (val == expected) &&
+                      (ts.seconds == expected);
+            ++expected;
+        });
+    }
+    producer.join();
+    ASSERT_TRUE(inOrder) << "Messages should arrive intact and in order";
+    ASSERT_EQ(MESSAGES, expected);
+}
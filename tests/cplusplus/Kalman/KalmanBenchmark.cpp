@@ -0,0 +1,312 @@
+/** @file
+    @brief Implementation of a throughput benchmark for the osvr::kalman
+   filters, process models, and measurements.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Kalman/FlexibleKalmanFilter.h>
+#include <osvr/Kalman/PoseConstantVelocity.h>
+#include <osvr/Kalman/PoseDampedConstantVelocity.h>
+#include <osvr/Kalman/PoseSeparatelyDampedConstantVelocity.h>
+#include <osvr/Kalman/AbsoluteOrientationMeasurement.h>
+#include <osvr/Kalman/AbsolutePositionMeasurement.h>
+#include <osvr/Kalman/AngularVelocityMeasurement.h>
+#include <osvr/Kalman/AugmentedProcessModel.h>
+#include <osvr/Kalman/AugmentedState.h>
+#include <osvr/Kalman/ConstantProcess.h>
+#include <osvr/Kalman/PureVectorState.h>
+
+// From the video-based tracker plugin, but needs only Eigen.
+#include "ImagePointMeasurement.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+/// @brief Counts every trip through the global operator new, so we can
+/// report allocations per update. (The fixed-size Eigen types used here never
+/// allocate, so anything counted is a regression.)
+static std::atomic<std::size_t> g_allocations(0);
+
+void *operator new(std::size_t size) {
+    ++g_allocations;
+    if (void *ret = std::malloc(size ? size : 1)) {
+        return ret;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+namespace kalman = osvr::kalman;
+using kalman::pose_externalized_rotation::State;
+using PositionMeasurement = kalman::AbsolutePositionMeasurement<State>;
+using OrientationMeasurement = kalman::AbsoluteOrientationMeasurement<State>;
+using AngularVelocityMeasurement = kalman::AngularVelocityMeasurement<State>;
+typedef std::chrono::steady_clock clock_type;
+
+static const double DT = 0.01;
+
+namespace {
+struct Result {
+    std::string name;
+    double nsPerUpdate;
+    double allocationsPerUpdate;
+};
+
+/// @brief A smoothly moving "true" pose to generate measurements from, so
+/// the filters do realistic work rather than settling to a constant.
+struct Motion {
+    explicit Motion(std::size_t i) : t(static_cast<double>(i) * DT) {}
+    Eigen::Vector3d position() const {
+        return Eigen::Vector3d(0.1 * std::sin(t), 0.05 * std::cos(2 * t),
+                               0.3 + 0.02 * std::sin(3 * t));
+    }
+    Eigen::Quaterniond orientation() const {
+        return Eigen::Quaterniond(
+            Eigen::AngleAxisd(0.5 * std::sin(t), Eigen::Vector3d::UnitY()) *
+            Eigen::AngleAxisd(0.2 * std::cos(t), Eigen::Vector3d::UnitX()));
+    }
+    Eigen::Vector3d angularVelocity() const {
+        return Eigen::Vector3d(-0.2 * std::sin(t), 0.5 * std::cos(t), 0);
+    }
+    double t;
+};
+
+/// @brief Runs @p update (given the iteration number) @p iterations times,
+/// after a short warm-up.
+template <typename F>
+Result measure(std::string const &name, std::size_t iterations, F &&update) {
+    for (std::size_t i = 0; i < iterations / 10; ++i) {
+        update(i);
+    }
+    auto allocationsBefore = g_allocations.load();
+    auto start = clock_type::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        update(i);
+    }
+    auto elapsed = clock_type::now() - start;
+    auto allocations = g_allocations.load() - allocationsBefore;
+    Result ret;
+    ret.name = name;
+    ret.nsPerUpdate =
+        std::chrono::duration<double, std::nano>(elapsed).count() /
+        iterations;
+    ret.allocationsPerUpdate =
+        static_cast<double>(allocations) / static_cast<double>(iterations);
+    return ret;
+}
+
+/// @brief Keeps the optimizer from discarding the filter work.
+double g_sink = 0;
+
+template <typename ProcessModel>
+void benchmarkProcessModel(std::string const &modelName,
+                           std::size_t iterations,
+                           std::vector<Result> &results) {
+    using Filter = kalman::FlexibleKalmanFilter<ProcessModel>;
+    const Eigen::Vector3d positionVariance = Eigen::Vector3d::Constant(1e-5);
+    const Eigen::Vector3d orientationVariance =
+        Eigen::Vector3d::Constant(1e-5);
+    const Eigen::Vector3d angVelVariance = Eigen::Vector3d::Constant(1e-3);
+
+    {
+        Filter filter;
+        results.push_back(
+            measure(modelName + "/predict", iterations, [&](std::size_t) {
+                filter.predict(DT);
+                filter.state().postCorrect();
+            }));
+        g_sink += filter.state().position().x();
+    }
+    {
+        Filter filter;
+        PositionMeasurement meas{Eigen::Vector3d::Zero(), positionVariance};
+        results.push_back(measure(modelName + "/position", iterations,
+                                  [&](std::size_t i) {
+                                      meas.setMeasurement(
+                                          Motion(i).position());
+                                      filter.predict(DT);
+                                      filter.correct(meas);
+                                  }));
+        g_sink += filter.state().position().x();
+    }
+    {
+        Filter filter;
+        OrientationMeasurement meas{Eigen::Quaterniond::Identity(),
+                                    orientationVariance};
+        results.push_back(measure(modelName + "/orientation", iterations,
+                                  [&](std::size_t i) {
+                                      meas.setMeasurement(
+                                          Motion(i).orientation());
+                                      filter.predict(DT);
+                                      filter.correct(meas);
+                                  }));
+        g_sink += filter.state().position().x();
+    }
+    {
+        // There's no single absolute pose measurement type: a pose is
+        // applied as a position and an orientation correction.
+        Filter filter;
+        PositionMeasurement posMeas{Eigen::Vector3d::Zero(),
+                                    positionVariance};
+        OrientationMeasurement oriMeas{Eigen::Quaterniond::Identity(),
+                                       orientationVariance};
+        results.push_back(
+            measure(modelName + "/pose", iterations, [&](std::size_t i) {
+                Motion motion(i);
+                posMeas.setMeasurement(motion.position());
+                oriMeas.setMeasurement(motion.orientation());
+                filter.predict(DT);
+                filter.correct(posMeas);
+                filter.correct(oriMeas);
+            }));
+        g_sink += filter.state().position().x();
+    }
+    {
+        Filter filter;
+        AngularVelocityMeasurement meas{Eigen::Vector3d::Zero(),
+                                        angVelVariance};
+        results.push_back(measure(modelName + "/angularVelocity", iterations,
+                                  [&](std::size_t i) {
+                                      meas.setMeasurement(
+                                          Motion(i).angularVelocity());
+                                      filter.predict(DT);
+                                      filter.correct(meas);
+                                  }));
+        g_sink += filter.state().position().x();
+    }
+}
+
+/// @brief One beacon's correction in the video-based tracker: the pose
+/// state augmented with a beacon position, corrected by an image point.
+template <bool Sequential>
+Result benchmarkImagePoint(std::string const &name, std::size_t iterations) {
+    using osvr::vbtracker::CameraModel;
+    using osvr::vbtracker::ImagePointMeasurement;
+    static const std::size_t BEACONS = 34;
+    CameraModel cam;
+    cam.focalLength = 700;
+    cam.principalPoint = Eigen::Vector2d(320, 240);
+
+    kalman::PoseDampedConstantVelocityProcessModel model;
+    kalman::ConstantProcess<kalman::PureVectorState<> > beaconProcess;
+    State state;
+    state.position() = Eigen::Vector3d(0, 0, 0.4);
+    std::vector<kalman::PureVectorState<> > beacons;
+    for (std::size_t i = 0; i < BEACONS; ++i) {
+        beacons.emplace_back(
+            Eigen::Vector3d(0.01 * (i % 6) - 0.03, 0.01 * (i / 6) - 0.03,
+                            0.002 * i),
+            Eigen::Matrix3d::Identity() * 1e-6);
+    }
+    ImagePointMeasurement meas{cam};
+    meas.setVariance(2.);
+
+    auto ret = measure(name, iterations, [&](std::size_t i) {
+        auto beacon = i % BEACONS;
+        if (beacon == 0) {
+            kalman::predict(state, model, DT);
+        }
+        meas.setMeasurement(Eigen::Vector2d(320 + 10. * (beacon % 6) + i % 3,
+                                            240 + 10. * (beacon / 6)));
+        auto augmented = kalman::makeAugmentedState(state, beacons[beacon]);
+        meas.updateFromState(augmented);
+        auto augmentedModel =
+            kalman::makeAugmentedProcessModel(model, beaconProcess);
+        if (Sequential) {
+            kalman::correctSequential(augmented, augmentedModel, meas);
+        } else {
+            kalman::correct(augmented, augmentedModel, meas);
+        }
+    });
+    g_sink += state.position().x();
+    return ret;
+}
+} // namespace
+
+/// Usage: KalmanBenchmark [iterations [csvFile [label]]]
+///
+/// With a CSV file, appends one row per case (label, case, ns/update,
+/// allocations/update) so results can be compared across commits: label
+/// runs with something like the output of `git describe`.
+int main(int argc, char *argv[]) {
+    std::size_t iterations = 100000;
+    if (argc > 1) {
+        iterations = std::strtoul(argv[1], nullptr, 10);
+    }
+    if (iterations < 10) {
+        std::cerr << "Need at least 10 iterations." << std::endl;
+        return 1;
+    }
+    std::string csvFile = argc > 2 ? argv[2] : "";
+    std::string label = argc > 3 ? argv[3] : "unlabeled";
+
+    std::vector<Result> results;
+    benchmarkProcessModel<kalman::PoseConstantVelocityProcessModel>(
+        "PoseConstantVelocity", iterations, results);
+    benchmarkProcessModel<kalman::PoseDampedConstantVelocityProcessModel>(
+        "PoseDampedConstantVelocity", iterations, results);
+    benchmarkProcessModel<
+        kalman::PoseSeparatelyDampedConstantVelocityProcessModel>(
+        "PoseSeparatelyDampedConstantVelocity", iterations, results);
+    results.push_back(
+        benchmarkImagePoint<false>("AugmentedImagePoint/correct", iterations));
+    results.push_back(benchmarkImagePoint<true>(
+        "AugmentedImagePoint/correctSequential", iterations));
+
+    std::cout << std::left << std::setw(56) << "case" << std::right
+              << std::setw(12) << "ns/update" << std::setw(14)
+              << "allocs/update" << "\n";
+    for (auto const &result : results) {
+        std::cout << std::left << std::setw(56) << result.name << std::right
+                  << std::fixed << std::setprecision(1) << std::setw(12)
+                  << result.nsPerUpdate << std::setprecision(2)
+                  << std::setw(14) << result.allocationsPerUpdate << "\n";
+    }
+    std::cout << "(checksum " << g_sink << ")" << std::endl;
+
+    if (!csvFile.empty()) {
+        std::ofstream csv(csvFile, std::ios::app);
+        if (!csv) {
+            std::cerr << "Could not open " << csvFile << std::endl;
+            return 1;
+        }
+        for (auto const &result : results) {
+            csv << label << "," << result.name << "," << result.nsPerUpdate
+                << "," << result.allocationsPerUpdate << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+/** @file
+    @brief Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "ContentsInvalid.h"
+#include <osvr/Kalman/FlexibleKalmanFilter.h>
+#include <osvr/Kalman/PoseConstantVelocity.h>
+#include <osvr/Kalman/AbsolutePositionMeasurement.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+// - none
+
+using ProcessModel = osvr::kalman::PoseConstantVelocityProcessModel;
+using State = ProcessModel::State;
+using AbsolutePositionMeasurement =
+    osvr::kalman::AbsolutePositionMeasurement<State>;
+using Filter = osvr::kalman::FlexibleKalmanFilter<ProcessModel>;
+
+/// @brief A filter that has been moving for a while, so its error covariance
+/// has plenty of off-diagonal terms.
+static Filter getMovingFilter() {
+    Filter filter;
+    for (int i = 0; i < 5; ++i) {
+        filter.predict(0.1);
+        auto meas = AbsolutePositionMeasurement{
+            Eigen::Vector3d(0.1 * i, -0.05 * i, 0.02 * i * i),
+            Eigen::Vector3d(0.0001, 0.0002, 0.0003)};
+        filter.correct(meas);
+    }
+    filter.predict(0.1);
+    return filter;
+}
+
+TEST(KalmanSequentialCorrection, MatchesJointCorrection) {
+    auto joint = getMovingFilter();
+    auto sequential = joint;
+    auto meas =
+        AbsolutePositionMeasurement{Eigen::Vector3d(0.6, -0.2, 0.4),
+                                    Eigen::Vector3d(0.0004, 0.001, 0.0002)};
+    joint.correct(meas);
+    sequential.correctSequential(meas);
+
+    ASSERT_FALSE(stateContentsInvalid(sequential.state()));
+    ASSERT_FALSE(covarianceContentsInvalid(sequential.state()));
+    ASSERT_TRUE(sequential.state().stateVector().isApprox(
+        joint.state().stateVector(), 1e-9))
+        << "Sequential:\n"
+        << sequential.state().stateVector().transpose() << "\nJoint:\n"
+        << joint.state().stateVector().transpose();
+    ASSERT_TRUE(sequential.state().errorCovariance().isApprox(
+        joint.state().errorCovariance(), 1e-9));
+}
+
+TEST(KalmanSequentialCorrection, CovarianceStaysSymmetric) {
+    auto filter = getMovingFilter();
+    for (int i = 0; i < 100; ++i) {
+        filter.predict(0.01);
+        auto meas = AbsolutePositionMeasurement{
+            Eigen::Vector3d(0.01 * i, 0.5, -0.3),
+            Eigen::Vector3d(0.00001, 0.00003, 0.00002)};
+        filter.correctSequential(meas);
+        auto const &P = filter.state().errorCovariance();
+        ASSERT_TRUE(P.isApprox(P.transpose(), 0))
+            << "Not exactly symmetric after iteration " << i;
+        ASSERT_FALSE(covarianceContentsInvalid(filter.state()));
+    }
+}
@@ -0,0 +1,129 @@
+/** @file
+    @brief Test implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Util/PoseExtrapolation.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <cmath>
+
+using osvr::util::extrapolatePose;
+using osvr::util::angularVelocityFromIncrementalRotation;
+namespace ei = osvr::util::eigen_interop;
+
+static const double PI = 3.14159265358979323846;
+
+class PoseExtrapolation : public ::testing::Test {
+  public:
+    PoseExtrapolation() {
+        ei::map(pose).translation() = Eigen::Vector3d(1, 2, 3);
+        ei::map(pose).rotation() = Eigen::Quaterniond::Identity();
+        vel.linearVelocityValid = false;
+        vel.angularVelocityValid = false;
+        ei::map(vel.linearVelocity) = Eigen::Vector3d::Zero();
+        ei::map(vel.angularVelocity.incrementalRotation) =
+            Eigen::Quaterniond::Identity();
+        vel.angularVelocity.dt = 0;
+    }
+
+    /// @brief Sets a rotation about @p axis at @p rate radians per second,
+    /// expressed as the rotation over a short @p dt as the trackers do.
+    void setAngularVelocity(Eigen::Vector3d const &axis, double rate,
+                            double dt = 0.01) {
+        vel.angularVelocityValid = true;
+        ei::map(vel.angularVelocity.incrementalRotation) =
+            Eigen::Quaterniond(Eigen::AngleAxisd(rate * dt, axis));
+        vel.angularVelocity.dt = dt;
+    }
+
+    Eigen::Vector3d position() { return ei::map(pose).translation(); }
+    Eigen::Quaterniond orientation() { return ei::map(pose).rotation(); }
+
+    OSVR_PoseState pose;
+    OSVR_VelocityState vel;
+};
+
+TEST_F(PoseExtrapolation, NoValidVelocityLeavesPose) {
+    ei::map(vel.linearVelocity) = Eigen::Vector3d(5, 5, 5);
+    extrapolatePose(pose, vel, 0.5);
+    ASSERT_TRUE(position().isApprox(Eigen::Vector3d(1, 2, 3)));
+    ASSERT_TRUE(orientation().isApprox(Eigen::Quaterniond::Identity()));
+}
+
+TEST_F(PoseExtrapolation, LinearVelocity) {
+    vel.linearVelocityValid = true;
+    ei::map(vel.linearVelocity) = Eigen::Vector3d(1, 0, -2);
+    extrapolatePose(pose, vel, 0.5);
+    ASSERT_TRUE(position().isApprox(Eigen::Vector3d(1.5, 2, 2)));
+    ASSERT_TRUE(orientation().isApprox(Eigen::Quaterniond::Identity()));
+
+    extrapolatePose(pose, vel, -0.5);
+    ASSERT_TRUE(position().isApprox(Eigen::Vector3d(1, 2, 3)));
+}
+
+TEST_F(PoseExtrapolation, AngularVelocityRate) {
+    setAngularVelocity(Eigen::Vector3d::UnitY(), PI / 2);
+    Eigen::Vector3d omega =
+        angularVelocityFromIncrementalRotation(vel.angularVelocity);
+    ASSERT_TRUE(omega.isApprox(Eigen::Vector3d(0, PI / 2, 0)));
+}
+
+TEST_F(PoseExtrapolation, AngularVelocity) {
+    setAngularVelocity(Eigen::Vector3d::UnitY(), PI / 2);
+    extrapolatePose(pose, vel, 0.5);
+    Eigen::Quaterniond expected(
+        Eigen::AngleAxisd(PI / 4, Eigen::Vector3d::UnitY()));
+    ASSERT_TRUE(orientation().isApprox(expected));
+    ASSERT_TRUE(position().isApprox(Eigen::Vector3d(1, 2, 3)));
+}
+
+TEST_F(PoseExtrapolation, AngularVelocityIsInWorldFrame) {
+    ei::map(pose).rotation() = Eigen::Quaterniond(
+        Eigen::AngleAxisd(PI / 2, Eigen::Vector3d::UnitX()));
+    setAngularVelocity(Eigen::Vector3d::UnitY(), PI / 2);
+    extrapolatePose(pose, vel, 1.0);
+    Eigen::Quaterniond expected =
+        Eigen::AngleAxisd(PI / 2, Eigen::Vector3d::UnitY()) *
+        Eigen::AngleAxisd(PI / 2, Eigen::Vector3d::UnitX());
+    ASSERT_TRUE(orientation().isApprox(expected));
+}
+
+TEST_F(PoseExtrapolation, ZeroIntervalLeavesPose) {
+    vel.linearVelocityValid = true;
+    ei::map(vel.linearVelocity) = Eigen::Vector3d(1, 0, 0);
+    setAngularVelocity(Eigen::Vector3d::UnitZ(), PI);
+    extrapolatePose(pose, vel, 0);
+    ASSERT_TRUE(position().isApprox(Eigen::Vector3d(1, 2, 3)));
+    ASSERT_TRUE(orientation().isApprox(Eigen::Quaterniond::Identity()));
+}
+
+TEST_F(PoseExtrapolation, ZeroDtHasNoAngularVelocity) {
+    setAngularVelocity(Eigen::Vector3d::UnitZ(), PI);
+    vel.angularVelocity.dt = 0;
+    ASSERT_TRUE(
+        angularVelocityFromIncrementalRotation(vel.angularVelocity).isZero());
+}
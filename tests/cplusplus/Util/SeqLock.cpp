@@ -0,0 +1,126 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Util/SeqLock.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using osvr::util::SeqLock;
+
+namespace {
+/// Odd-sized so that it doesn't fill the last storage word exactly.
+struct Sample {
+    std::int64_t a;
+    std::int64_t b;
+    std::int64_t c;
+    std::int64_t d;
+    std::int32_t e;
+};
+
+inline Sample makeSample(std::int64_t v) {
+    Sample ret;
+    ret.a = ret.b = ret.c = ret.d = v;
+    ret.e = static_cast<std::int32_t>(v);
+    return ret;
+}
+
+inline bool isConsistent(Sample const &s) {
+    return s.a == s.b && s.b == s.c && s.c == s.d &&
+           static_cast<std::int32_t>(s.d) == s.e;
+}
+} // namespace
+
+TEST(SeqLock, emptyLoadFails) {
+    SeqLock<Sample> lock;
+    ASSERT_FALSE(lock.hasValue());
+    Sample s = makeSample(-1);
+    ASSERT_FALSE(lock.load(s));
+    ASSERT_EQ(-1, s.a) << "Value should be left untouched";
+}
+
+TEST(SeqLock, storeThenLoad) {
+    SeqLock<Sample> lock;
+    lock.store(makeSample(42));
+    ASSERT_TRUE(lock.hasValue());
+    Sample s;
+    ASSERT_TRUE(lock.load(s));
+    ASSERT_TRUE(isConsistent(s));
+    ASSERT_EQ(42, s.a);
+
+    lock.store(makeSample(43));
+    ASSERT_TRUE(lock.load(s));
+    ASSERT_EQ(43, s.a);
+}
+
+TEST(SeqLock, concurrentReadersSeeConsistentValues) {
+    static const std::int64_t ITERATIONS = 200000;
+    static const int READERS = 3;
+    SeqLock<Sample> lock;
+    std::atomic<bool> done(false);
+    std::atomic<int> torn(0);
+    std::atomic<int> regressed(0);
+
+    std::vector<std::thread> readers;
+    for (int i = 0; i < READERS; ++i) {
+        readers.emplace_back([&] {
+            std::int64_t last = 0;
+            Sample s;
+            while (!done) {
+                if (!lock.load(s)) {
+                    continue;
+                }
+                if (!isConsistent(s)) {
+                    ++torn;
+                }
+                if (s.a < last) {
+                    ++regressed;
+                }
+                last = s.a;
+            }
+        });
+    }
+
+    for (std::int64_t i = 1; i <= ITERATIONS; ++i) {
+        lock.store(makeSample(i));
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_EQ(0, torn.load()) << "Readers should never see a partial write";
+    ASSERT_EQ(0, regressed.load()) << "Readers should never go back in time";
+    Sample s;
+    ASSERT_TRUE(lock.load(s));
+    ASSERT_EQ(ITERATIONS, s.a);
+}
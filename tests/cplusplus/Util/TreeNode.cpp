@@ -314,3 +314,67 @@ TEST(TreeNode, ParentPointers) {
     ParentCheckerVisitor visitor;
     visitor(*tree);
 }
+
+TEST(TreeNode, ManyChildren) {
+    // Enough children to switch from linear search to the hash index.
+    static const int COUNT = 100;
+    IntTreePtr tree = IntTree::createRoot();
+    for (int i = 0; i < COUNT; ++i) {
+        ASSERT_NO_THROW(IntTree::create(*tree, std::to_string(i), i));
+        for (int j = 0; j <= i; ++j) {
+            ASSERT_EQ(tree->getChildByName(std::to_string(j)).value(), j);
+        }
+        ASSERT_THROW(tree->getChildByName(std::to_string(i + 1)),
+                     osvr::util::tree::NoSuchChild);
+    }
+    ASSERT_EQ(tree->numChildren(), COUNT);
+    ASSERT_THROW(IntTree::create(*tree, "50"), std::logic_error);
+    ASSERT_EQ(&tree->getOrCreateChildByName("50"),
+              &tree->getChildByName("50"));
+    ASSERT_EQ(tree->numChildren(), COUNT);
+
+    // Visitation order is still creation order.
+    int expected = 0;
+    auto orderChecker = [&](IntTree const &node) {
+        ASSERT_EQ(node.value(), expected);
+        expected++;
+    };
+    tree->visitConstChildren(orderChecker);
+    ASSERT_EQ(expected, COUNT);
+}
+
+TEST(TreeNode, RemoveChild) {
+    IntTreePtr tree = IntTree::createRoot();
+    IntTree::create(*tree, "a", 1);
+    IntTree::create(IntTree::create(*tree, "b", 2), "c", 3);
+    ASSERT_FALSE(tree->removeChildByName("c")) << "Only direct children";
+    ASSERT_TRUE(tree->removeChildByName("b"));
+    ASSERT_FALSE(tree->removeChildByName("b"));
+    ASSERT_EQ(tree->numChildren(), 1);
+    ASSERT_THROW(tree->getChildByName("b"), osvr::util::tree::NoSuchChild);
+    ASSERT_EQ(tree->getOrCreateChildByName("b").value(), 0)
+        << "Re-created as a new node";
+    ASSERT_EQ(tree->getChildByName("a").value(), 1);
+}
+
+TEST(TreeNode, RemoveChildOfMany) {
+    static const int COUNT = 100;
+    IntTreePtr tree = IntTree::createRoot();
+    for (int i = 0; i < COUNT; ++i) {
+        IntTree::create(*tree, std::to_string(i), i);
+    }
+    for (int i = 0; i < COUNT; i += 2) {
+        ASSERT_TRUE(tree->removeChildByName(std::to_string(i)));
+    }
+    ASSERT_EQ(tree->numChildren(), COUNT / 2);
+    for (int i = 0; i < COUNT; ++i) {
+        if (i % 2 == 0) {
+            ASSERT_THROW(tree->getChildByName(std::to_string(i)),
+                         osvr::util::tree::NoSuchChild);
+        } else {
+            ASSERT_EQ(tree->getChildByName(std::to_string(i)).value(), i);
+        }
+    }
+    ASSERT_NO_THROW(IntTree::create(*tree, "0", 7));
+    ASSERT_EQ(tree->getChildByName("0").value(), 7);
+}
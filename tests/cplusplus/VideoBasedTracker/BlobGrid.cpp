@@ -0,0 +1,187 @@
+/** @file
+    @brief Test cross-checking the grid-based blob association against the
+    linear search it replaced, on seeded random frames.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "BlobGrid.h"
+#include "LED.h"
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <cmath>
+#include <random>
+#include <vector>
+
+using osvr::vbtracker::BlobClaims;
+using osvr::vbtracker::BlobGrid;
+using osvr::vbtracker::LedMeasurement;
+using osvr::vbtracker::LedMeasurementIterator;
+using osvr::vbtracker::LedMeasurementList;
+
+namespace {
+/// @brief The linear search the tracker used before BlobGrid (formerly
+/// Led::nearest): the first of the closest measurements, if within the
+/// threshold.
+inline LedMeasurementIterator linearNearest(cv::Point2f const &location,
+                                            LedMeasurementList &meas,
+                                            double threshold) {
+    if (meas.empty()) {
+        return end(meas);
+    }
+    auto thresholdSquared = threshold * threshold;
+    auto computeDistSquared = [location](LedMeasurementIterator it) {
+        auto diff = (location - it->loc);
+        return diff.dot(diff);
+    };
+    auto ret = begin(meas);
+    auto minDistSq = computeDistSquared(ret);
+    for (auto it = begin(meas), e = end(meas); it != e; ++it) {
+        auto distSq = computeDistSquared(it);
+        if (distSq < minDistSq) {
+            minDistSq = distSq;
+            ret = it;
+        }
+    }
+    if (minDistSq <= thresholdSquared) {
+        return ret;
+    }
+    return end(meas);
+}
+
+inline LedMeasurement makeMeasurement(float x, float y) {
+    LedMeasurement meas;
+    meas.loc = cv::Point2f(x, y);
+    return meas;
+}
+
+/// @brief Associates each LED location in turn, as the tracker does, both
+/// with the grid and with the old approach of searching a copy of the
+/// measurements and erasing each one as it's taken, checking they agree.
+inline void checkAssociation(LedMeasurementList const &meas,
+                             std::vector<cv::Point2f> const &leds,
+                             double threshold, float cellSize) {
+    BlobGrid grid;
+    grid.build(meas, cellSize);
+    ASSERT_EQ(meas.size(), grid.size());
+    BlobClaims claims;
+    claims.reset(meas.size());
+
+    LedMeasurementList remaining(meas);
+    std::vector<std::size_t> remainingIndices;
+    for (std::size_t i = 0; i < meas.size(); ++i) {
+        remainingIndices.push_back(i);
+    }
+
+    for (std::size_t led = 0; led < leds.size(); ++led) {
+        SCOPED_TRACE(led);
+        auto expected = BlobGrid::NOT_FOUND;
+        auto it = linearNearest(leds[led], remaining, threshold);
+        if (it != end(remaining)) {
+            auto offset = it - begin(remaining);
+            expected = remainingIndices[offset];
+            remaining.erase(it);
+            remainingIndices.erase(begin(remainingIndices) + offset);
+        }
+        auto actual = grid.nearest(leds[led], threshold, claims);
+        ASSERT_EQ(expected, actual);
+        if (actual != BlobGrid::NOT_FOUND) {
+            claims.claim(actual);
+        }
+    }
+}
+} // namespace
+
+TEST(BlobGrid, Empty) {
+    LedMeasurementList meas;
+    ASSERT_NO_FATAL_FAILURE(
+        checkAssociation(meas, {cv::Point2f(10, 10)}, 5., 5.f));
+}
+
+TEST(BlobGrid, TiesGoToLowestIndex) {
+    // Equidistant from the LED, and one duplicated, in decreasing index
+    // order across cells.
+    LedMeasurementList meas = {makeMeasurement(30, 20),
+                               makeMeasurement(10, 20),
+                               makeMeasurement(20, 30),
+                               makeMeasurement(20, 30)};
+    std::vector<cv::Point2f> leds(5, cv::Point2f(20, 20));
+    ASSERT_NO_FATAL_FAILURE(checkAssociation(meas, leds, 10., 4.f));
+}
+
+TEST(BlobGrid, OutsideThreshold) {
+    LedMeasurementList meas = {makeMeasurement(0, 0),
+                               makeMeasurement(100, 100)};
+    std::vector<cv::Point2f> leds = {cv::Point2f(0, 5.01f),
+                                     cv::Point2f(-50, 50),
+                                     cv::Point2f(200, 100), cv::Point2f(0, 5)};
+    ASSERT_NO_FATAL_FAILURE(checkAssociation(meas, leds, 5., 5.f));
+}
+
+TEST(BlobGrid, RandomFrames) {
+    std::mt19937 gen(2016);
+    std::uniform_int_distribution<int> blobCount(0, 60);
+    std::uniform_int_distribution<int> ledCount(0, 40);
+    std::uniform_real_distribution<float> x(0, 640);
+    std::uniform_real_distribution<float> y(0, 480);
+    std::normal_distribution<float> jitter(0, 4);
+    std::uniform_real_distribution<double> threshold(0.5, 30);
+    std::bernoulli_distribution nearBlob(0.8);
+    std::bernoulli_distribution onPixelCenters(0.3);
+    // Include cells much smaller and much larger than the search radius.
+    const float cellSizes[] = {0.25f, 2.f, 10.f, 25.f, 100.f, 1000.f};
+
+    for (int trial = 0; trial < 2000; ++trial) {
+        SCOPED_TRACE(trial);
+        // Some frames on whole pixels, so there are exact ties.
+        auto whole = onPixelCenters(gen);
+        auto snap = [&](float v) { return whole ? std::floor(v) : v; };
+
+        LedMeasurementList meas;
+        auto numBlobs = blobCount(gen);
+        for (int i = 0; i < numBlobs; ++i) {
+            meas.push_back(makeMeasurement(snap(x(gen)), snap(y(gen))));
+        }
+
+        std::vector<cv::Point2f> leds;
+        auto numLeds = ledCount(gen);
+        for (int i = 0; i < numLeds; ++i) {
+            if (!meas.empty() && nearBlob(gen)) {
+                std::uniform_int_distribution<std::size_t> which(
+                    0, meas.size() - 1);
+                auto const &loc = meas[which(gen)].loc;
+                leds.emplace_back(snap(loc.x + jitter(gen)),
+                                  snap(loc.y + jitter(gen)));
+            } else {
+                leds.emplace_back(snap(x(gen)), snap(y(gen)));
+            }
+        }
+
+        auto cellSize =
+            cellSizes[trial % (sizeof(cellSizes) / sizeof(float))];
+        ASSERT_NO_FATAL_FAILURE(
+            checkAssociation(meas, leds, threshold(gen), cellSize));
+    }
+}
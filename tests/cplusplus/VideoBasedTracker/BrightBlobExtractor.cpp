@@ -0,0 +1,335 @@
+/** @file
+    @brief Test checking the run-based connected-component labeling of the
+    bright blob extractor against a flood fill, on seeded random images.
+
+    Run with each of the extractor's row scans (scalar, SSE2, and AVX2)
+    that this build and processor can use.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "BrightBlobExtractor.h"
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using osvr::vbtracker::BrightBlobExtractor;
+using osvr::vbtracker::BrightPixelScan;
+using osvr::vbtracker::ConfigParams;
+using osvr::vbtracker::LedMeasurement;
+
+namespace osvr {
+namespace vbtracker {
+    /// @brief Names the scan in test output.
+    inline void PrintTo(BrightPixelScan scan, std::ostream *os) {
+        switch (scan) {
+        case BrightPixelScan::Scalar:
+            *os << "Scalar";
+            break;
+        case BrightPixelScan::SSE2:
+            *os << "SSE2";
+            break;
+        case BrightPixelScan::AVX2:
+            *os << "AVX2";
+            break;
+        }
+    }
+} // namespace vbtracker
+} // namespace osvr
+
+namespace {
+/// @brief Blob parameters under which the extractor labels the pixels
+/// strictly above @p threshold (as long as the image has a pixel at or below
+/// it), keeping every blob.
+inline ConfigParams makeParams(std::uint8_t threshold) {
+    ConfigParams params;
+    params.blobParams.minThresholdAlpha = 0;
+    params.blobParams.absoluteMinThreshold = threshold;
+    params.blobParams.minArea = 1;
+    return params;
+}
+
+/// @brief Labels the 8-connected components above the threshold by flood
+/// fill, computing measurements the same way the extractor documents.
+inline std::vector<LedMeasurement> floodFillBlobs(cv::Mat const &img,
+                                                   std::uint8_t threshold) {
+    std::vector<LedMeasurement> ret;
+    cv::Mat visited = cv::Mat::zeros(img.rows, img.cols, CV_8UC1);
+    std::vector<std::pair<int, int> > stack;
+    for (int y0 = 0; y0 < img.rows; ++y0) {
+        for (int x0 = 0; x0 < img.cols; ++x0) {
+            if (visited.at<std::uint8_t>(y0, x0) ||
+                img.at<std::uint8_t>(y0, x0) <= threshold) {
+                continue;
+            }
+            std::uint64_t area = 0;
+            std::uint64_t sumWeight = 0;
+            std::uint64_t sumWeightedX = 0;
+            std::uint64_t sumWeightedY = 0;
+            int minX = x0;
+            int maxX = x0;
+            int minY = y0;
+            int maxY = y0;
+            visited.at<std::uint8_t>(y0, x0) = 1;
+            stack.emplace_back(x0, y0);
+            while (!stack.empty()) {
+                int x = stack.back().first;
+                int y = stack.back().second;
+                stack.pop_back();
+                std::uint64_t weight = img.at<std::uint8_t>(y, x) - threshold;
+                ++area;
+                sumWeight += weight;
+                sumWeightedX += weight * static_cast<std::uint64_t>(x);
+                sumWeightedY += weight * static_cast<std::uint64_t>(y);
+                minX = std::min(minX, x);
+                maxX = std::max(maxX, x);
+                minY = std::min(minY, y);
+                maxY = std::max(maxY, y);
+                for (int ny = std::max(y - 1, 0);
+                     ny <= std::min(y + 1, img.rows - 1); ++ny) {
+                    for (int nx = std::max(x - 1, 0);
+                         nx <= std::min(x + 1, img.cols - 1); ++nx) {
+                        if (!visited.at<std::uint8_t>(ny, nx) &&
+                            img.at<std::uint8_t>(ny, nx) > threshold) {
+                            visited.at<std::uint8_t>(ny, nx) = 1;
+                            stack.emplace_back(nx, ny);
+                        }
+                    }
+                }
+            }
+            LedMeasurement meas;
+            auto w = static_cast<double>(sumWeight);
+            meas.loc = cv::Point2f(static_cast<float>(sumWeightedX / w),
+                                   static_cast<float>(sumWeightedY / w));
+            meas.area = static_cast<float>(area);
+            meas.knowBoundingBox = true;
+            meas.boundingBox =
+                cv::Size2f(static_cast<float>(maxX - minX + 1),
+                           static_cast<float>(maxY - minY + 1));
+            ret.push_back(meas);
+        }
+    }
+    return ret;
+}
+
+/// @brief Puts measurements in a canonical order, since the two labelings
+/// find blobs in different orders.
+inline void sortBlobs(std::vector<LedMeasurement> &blobs) {
+    std::sort(blobs.begin(), blobs.end(),
+              [](LedMeasurement const &a, LedMeasurement const &b) {
+                  return std::make_tuple(a.loc.y, a.loc.x, a.area,
+                                         a.boundingBox.width,
+                                         a.boundingBox.height) <
+                         std::make_tuple(b.loc.y, b.loc.x, b.area,
+                                         b.boundingBox.width,
+                                         b.boundingBox.height);
+              });
+}
+
+/// @brief Random image: each pixel is bright (above the threshold) with the
+/// given probability, and dark (at or below it) otherwise.
+inline cv::Mat randomImage(std::mt19937 &gen, int rows, int cols,
+                           std::uint8_t threshold, double brightFraction) {
+    cv::Mat img(rows, cols, CV_8UC1);
+    std::bernoulli_distribution isBright(brightFraction);
+    std::uniform_int_distribution<int> dark(0, threshold);
+    std::uniform_int_distribution<int> bright(threshold + 1, 255);
+    for (int y = 0; y < rows; ++y) {
+        auto row = img.ptr<std::uint8_t>(y);
+        for (int x = 0; x < cols; ++x) {
+            row[x] = static_cast<std::uint8_t>(isBright(gen) ? bright(gen)
+                                                             : dark(gen));
+        }
+    }
+    return img;
+}
+
+inline void compareWithFloodFill(BrightPixelScan scan, cv::Mat const &img,
+                                 std::uint8_t threshold) {
+    BrightBlobExtractor extractor(makeParams(threshold), scan);
+    auto actual = extractor.extractBlobs(img);
+    auto expected = floodFillBlobs(img, threshold);
+    sortBlobs(actual);
+    sortBlobs(expected);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        SCOPED_TRACE(i);
+        ASSERT_FLOAT_EQ(expected[i].area, actual[i].area);
+        ASSERT_FLOAT_EQ(expected[i].loc.x, actual[i].loc.x);
+        ASSERT_FLOAT_EQ(expected[i].loc.y, actual[i].loc.y);
+        ASSERT_TRUE(actual[i].knowBoundingBox);
+        ASSERT_FLOAT_EQ(expected[i].boundingBox.width,
+                        actual[i].boundingBox.width);
+        ASSERT_FLOAT_EQ(expected[i].boundingBox.height,
+                        actual[i].boundingBox.height);
+    }
+}
+
+const std::uint8_t THRESHOLD = 100;
+} // namespace
+
+class BrightBlobExtractorLabeling
+    : public ::testing::TestWithParam<BrightPixelScan> {
+  public:
+    void SetUp() override {
+        if (!scanAvailable()) {
+            std::cout << "This build or processor can't use this scan: not "
+                         "checking it."
+                      << std::endl;
+        }
+    }
+
+    bool scanAvailable() const {
+        return osvr::vbtracker::isBrightPixelScanAvailable(GetParam());
+    }
+
+    void checkMatchesFloodFill(cv::Mat const &img) {
+        compareWithFloodFill(GetParam(), img, THRESHOLD);
+    }
+};
+
+TEST_P(BrightBlobExtractorLabeling, EmptyImage) {
+    if (!scanAvailable()) {
+        return;
+    }
+    cv::Mat img = cv::Mat::zeros(48, 64, CV_8UC1);
+    BrightBlobExtractor extractor(makeParams(THRESHOLD), GetParam());
+    ASSERT_TRUE(extractor.extractBlobs(img).empty());
+}
+
+TEST_P(BrightBlobExtractorLabeling, DiagonalNeighborsJoin) {
+    if (!scanAvailable()) {
+        return;
+    }
+    cv::Mat img = cv::Mat::zeros(8, 40, CV_8UC1);
+    // Touching only at corners, across the 16- and 32-pixel chunk edges.
+    for (int i = 0; i < 4; ++i) {
+        img.at<std::uint8_t>(2 + i, 14 + i) = 200;
+        img.at<std::uint8_t>(2 + i, 33 - i) = 200;
+    }
+    BrightBlobExtractor extractor(makeParams(THRESHOLD), GetParam());
+    ASSERT_EQ(2u, extractor.extractBlobs(img).size());
+    checkMatchesFloodFill(img);
+}
+
+TEST_P(BrightBlobExtractorLabeling, MergesBranches) {
+    if (!scanAvailable()) {
+        return;
+    }
+    // A "W": three columns that only join at the bottom row, so the labels
+    // started on each must be merged.
+    cv::Mat img = cv::Mat::zeros(10, 70, CV_8UC1);
+    for (int y = 1; y < 8; ++y) {
+        img.at<std::uint8_t>(y, 3) = 150;
+        img.at<std::uint8_t>(y, 35) = 250;
+        img.at<std::uint8_t>(y, 66) = 101;
+    }
+    img.row(8).colRange(3, 67).setTo(120);
+    BrightBlobExtractor extractor(makeParams(THRESHOLD), GetParam());
+    ASSERT_EQ(1u, extractor.extractBlobs(img).size());
+    checkMatchesFloodFill(img);
+}
+
+TEST_P(BrightBlobExtractorLabeling, RandomImages) {
+    if (!scanAvailable()) {
+        return;
+    }
+    std::mt19937 gen(2016);
+    // Widths on either side of the vector widths, so both the vector loops
+    // and the scalar tails see runs starting and ending everywhere.
+    std::uniform_int_distribution<int> rows(1, 24);
+    std::uniform_int_distribution<int> cols(1, 100);
+    const double fractions[] = {0.01, 0.05, 0.2, 0.45, 0.7, 0.95};
+    for (int i = 0; i < 500; ++i) {
+        SCOPED_TRACE(i);
+        auto fraction = fractions[i % (sizeof(fractions) / sizeof(double))];
+        auto img =
+            randomImage(gen, rows(gen), cols(gen), THRESHOLD, fraction);
+        // Keep a pixel at or below the threshold, so it isn't raised to the
+        // dimmest pixel of an all-bright image.
+        img.at<std::uint8_t>(0, 0) = 0;
+        ASSERT_NO_FATAL_FAILURE(checkMatchesFloodFill(img));
+    }
+}
+
+TEST_P(BrightBlobExtractorLabeling, RandomSubImages) {
+    if (!scanAvailable()) {
+        return;
+    }
+    // Regions of a larger image: rows aren't contiguous or aligned.
+    std::mt19937 gen(42);
+    auto full = randomImage(gen, 60, 130, THRESHOLD, 0.3);
+    std::uniform_int_distribution<int> offset(0, 29);
+    for (int i = 0; i < 100; ++i) {
+        SCOPED_TRACE(i);
+        auto x = offset(gen);
+        auto y = offset(gen);
+        cv::Mat copy = full.clone();
+        copy.at<std::uint8_t>(y, x) = 0;
+        cv::Mat img = copy(cv::Rect(x, y, 100 - x % 7, 30));
+        ASSERT_NO_FATAL_FAILURE(checkMatchesFloodFill(img));
+    }
+}
+
+TEST_P(BrightBlobExtractorLabeling, RandomCameraFrames) {
+    if (!scanAvailable()) {
+        return;
+    }
+    // Camera-sized frames with scattered LED-like spots on a noisy
+    // background.
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> noise(0, THRESHOLD);
+    std::uniform_int_distribution<int> spotX(0, 639);
+    std::uniform_int_distribution<int> spotY(0, 479);
+    std::uniform_int_distribution<int> spotRadius(0, 6);
+    std::uniform_int_distribution<int> spotValue(THRESHOLD + 1, 255);
+    for (int i = 0; i < 5; ++i) {
+        SCOPED_TRACE(i);
+        cv::Mat img(480, 640, CV_8UC1);
+        for (int y = 0; y < img.rows; ++y) {
+            auto row = img.ptr<std::uint8_t>(y);
+            for (int x = 0; x < img.cols; ++x) {
+                row[x] = static_cast<std::uint8_t>(noise(gen));
+            }
+        }
+        for (int spot = 0; spot < 40; ++spot) {
+            cv::circle(img, cv::Point(spotX(gen), spotY(gen)),
+                       spotRadius(gen), cv::Scalar(spotValue(gen)), -1);
+        }
+        ASSERT_NO_FATAL_FAILURE(checkMatchesFloodFill(img));
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(AllScans, BrightBlobExtractorLabeling,
+                        ::testing::Values(BrightPixelScan::Scalar,
+                                          BrightPixelScan::SSE2,
+                                          BrightPixelScan::AVX2));
@@ -0,0 +1,200 @@
+/** @file
+    @brief Test cross-checking the bitmask-based HDK LED identifier against
+    the original string-search implementation.
+
+    @date 2016
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2016 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "HDKLedIdentifier.h"
+#include "BrightnessHistory.h"
+#include "LED.h"
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <algorithm>
+#include <fstream>
+#include <list>
+#include <random>
+#include <string>
+
+using namespace osvr::vbtracker;
+
+namespace {
+/// @brief The original identifier: thresholds into a string of '*' and '.'
+/// and searches each "wrapped" (doubled) pattern for it.
+class ReferenceIdentifier {
+  public:
+    explicit ReferenceIdentifier(PatternStringList const &patterns) {
+        for (auto &pat : patterns) {
+            if (!pat.empty() && pat.find_first_not_of("*.") == pat.npos) {
+                m_length = pat.length();
+                break;
+            }
+        }
+        for (auto &pat : patterns) {
+            if (pat.empty() || pat.find_first_not_of("*.") != pat.npos) {
+                m_wrapped.emplace_back();
+                continue;
+            }
+            auto wrapped = pat + pat;
+            wrapped.pop_back();
+            m_wrapped.push_back(wrapped);
+        }
+    }
+
+    int getId(int currentId, std::list<float> &brightnesses, bool &lastBright,
+              bool blobsKeepId) const {
+        if (brightnesses.size() < m_length) {
+            return Led::SENTINEL_NO_IDENTIFIER_OBJECT_OR_INSUFFICIENT_DATA;
+        }
+        while (brightnesses.size() > m_length) {
+            brightnesses.pop_front();
+        }
+        auto extrema =
+            std::minmax_element(begin(brightnesses), end(brightnesses));
+        auto minVal = *extrema.first;
+        auto maxVal = *extrema.second;
+        if (maxVal - minVal <= 0.3) {
+            return Led::SENTINEL_INSUFFICIENT_EXTREMA_DIFFERENCE;
+        }
+        const auto threshold = (minVal + maxVal) / 2;
+        lastBright = brightnesses.back() >= threshold;
+        if (blobsKeepId && currentId >= 0) {
+            return currentId;
+        }
+        std::string bits;
+        for (auto val : brightnesses) {
+            bits.push_back(val >= threshold ? '*' : '.');
+        }
+        for (size_t i = 0; i < m_wrapped.size(); i++) {
+            if (!m_wrapped[i].empty() &&
+                m_wrapped[i].find(bits) != std::string::npos) {
+                return static_cast<int>(i);
+            }
+        }
+        return Led::SENTINEL_NO_PATTERN_RECOGNIZED_DESPITE_SUFFICIENT_DATA;
+    }
+
+  private:
+    size_t m_length = 0;
+    std::vector<std::string> m_wrapped;
+};
+
+/// @brief Loads the designed HDK LED patterns used to render the simulated
+/// images.
+PatternStringList loadSimulatedPatterns() {
+    PatternStringList ret;
+    std::ifstream file(VBTRACKER_SIMULATED_PATTERNS_FILE);
+    std::string line;
+    while (std::getline(file, line)) {
+        line.erase(line.find_last_not_of(" \r\t") + 1);
+        if (!line.empty()) {
+            ret.push_back(line);
+        }
+    }
+    return ret;
+}
+
+/// @brief Feeds the same brightness streams to both identifiers, as an LED
+/// would, and checks that every result matches.
+void crossCheck(PatternStringList const &patterns, unsigned seed) {
+    ReferenceIdentifier reference(patterns);
+    OsvrHdkLedIdentifier identifier(patterns);
+    auto length = patterns.front().size();
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> noise(-0.4f, 0.4f);
+    std::uniform_real_distribution<float> level(2.f, 8.f);
+    std::uniform_int_distribution<size_t> pick(0, patterns.size());
+    std::uniform_int_distribution<int> coin(0, 1);
+
+    for (int stream = 0; stream < 2000; ++stream) {
+        // Either a (rotated) pattern, possibly with noise and glitches, or
+        // random garbage when pick() lands past the end.
+        auto which = pick(rng);
+        std::string const *pat =
+            which < patterns.size() ? &patterns[which] : nullptr;
+        auto phase = pick(rng);
+        auto dim = level(rng);
+        auto bright = dim + level(rng) * coin(rng);
+        auto noisy = coin(rng) != 0;
+
+        std::list<float> refHistory;
+        BrightnessHistory history;
+        int refId = Led::SENTINEL_NO_IDENTIFIER_OBJECT_OR_INSUFFICIENT_DATA;
+        int id = refId;
+        bool refLastBright = false;
+        bool lastBright = false;
+        auto frames = 3 * length + pick(rng);
+        for (size_t frame = 0; frame < frames; ++frame) {
+            bool on = pat && !pat->empty()
+                          ? (*pat)[(frame + phase) % pat->size()] == '*'
+                          : coin(rng) != 0;
+            if (noisy && pick(rng) == 0) {
+                on = !on;
+            }
+            auto val = (on ? bright : dim) + (noisy ? noise(rng) : 0.f);
+            refHistory.push_back(val);
+            history.push_back(val);
+            auto keep = coin(rng) != 0;
+            refId = reference.getId(refId, refHistory, refLastBright, keep);
+            id = identifier.getId(id, history, lastBright, keep);
+            ASSERT_EQ(refId, id) << "stream " << stream << " frame " << frame;
+            ASSERT_EQ(refLastBright, lastBright);
+            ASSERT_EQ(refHistory.size(), history.size());
+        }
+    }
+}
+} // namespace
+
+TEST(BrightnessHistory, keepsNewestSamples) {
+    BrightnessHistory history;
+    ASSERT_TRUE(history.empty());
+    for (int i = 0; i < 40; ++i) {
+        history.push_back(static_cast<float>(i));
+    }
+    ASSERT_EQ(std::size_t(BrightnessHistory::CAPACITY), history.size());
+    ASSERT_EQ(8.f, history[0]);
+    ASSERT_EQ(39.f, history.back());
+    history.truncateTo(4);
+    ASSERT_EQ(4, history.size());
+    ASSERT_EQ(36.f, history[0]);
+    history.clear();
+    ASSERT_TRUE(history.empty());
+}
+
+TEST(HDKLedIdentifier, matchesReferenceOnSimulatedImagePatterns) {
+    auto patterns = loadSimulatedPatterns();
+    ASSERT_FALSE(patterns.empty());
+    crossCheck(patterns, 1);
+}
+
+TEST(HDKLedIdentifier, matchesReferenceWithDuplicatesAndDisabledPatterns) {
+    // Like the patterns seen in the HDK random images: some patterns are
+    // rotations of others (the lowest index must win) and some are disabled.
+    PatternStringList patterns = {"..*.....", "...*....", "", "*......*",
+                                  "....*.*.", "**......", ".*.*.*..",
+                                  "disabled", "...*.***", ".*.*.*.."};
+    crossCheck(patterns, 2);
+}